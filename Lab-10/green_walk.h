@@ -0,0 +1,155 @@
+/*
+ * ================================================================
+ * green_walk.h: 差異幀動畫資料（64x64，6幀）
+ * 由 Tools/LcdDelta 產生，請勿手動修改：
+ *   lcddelta -n green_walk -o Lab-10/green_walk.h Lab-10/Lance_bmp_first.c green1 green2 green3 green4 green5 green6
+ * ================================================================
+ */
+
+#ifndef __GREEN_WALK_H__
+#define __GREEN_WALK_H__
+
+#include "LCD_Delta.h"
+
+// 第1幀（keyframe）
+static const uint8_t green_walk_key[512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF8, 0xF8, 0xB0, 0xA0, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+    0x0E, 0x0F, 0x0F, 0x0F, 0x6F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x07, 0x0F, 0x0F, 0x07,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F,
+    0x7F, 0xFF, 0xFF, 0x67, 0x66, 0x66, 0xFF, 0xFF, 0x7E, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x70, 0x78, 0x78, 0xFC, 0xFC, 0x8F, 0x8F, 0x8F, 0xC7,
+    0xF7, 0xF7, 0xF7, 0x76, 0x76, 0x76, 0xFF, 0xFF, 0xFE, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x1F, 0x1F, 0x3E, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x0F, 0x0F, 0x8F, 0xE1, 0xF0, 0xF7, 0xF0,
+    0xEE, 0xFE, 0xFE, 0xEF, 0xE1, 0xE0, 0xF0, 0xF0, 0xE0, 0xFE, 0xFF, 0xFF, 0xEF, 0x60, 0xF0, 0xE0,
+    0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x20, 0xE0, 0xE0, 0xE0, 0xE1, 0x21, 0xE1, 0xE1, 0xF8,
+    0xFC, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x01, 0x05, 0xED, 0xEC, 0xED, 0xED, 0x7D, 0x3F, 0x1F, 0x0D,
+    0x2D, 0xE0, 0xE1, 0xE1, 0xE1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// 第1幀 -> 第2幀：13段，每段 page, x, len, XOR資料
+static const uint8_t green_walk_d0[206] = {
+    0x00, 0x11, 0x10, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x48, 0x58, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x0F, 0x06, 0x09, 0x09, 0x08, 0x08, 0x08, 0x10,
+    0x01, 0x1B, 0x08, 0x80, 0xF8, 0x98, 0x88, 0x80, 0x84, 0x07, 0x04,
+    0x02, 0x17, 0x01, 0xF8,
+    0x02, 0x20, 0x08, 0x07, 0x07, 0x08, 0x08, 0x70, 0x70, 0x80, 0x80,
+    0x03, 0x17, 0x01, 0x0F,
+    0x03, 0x1C, 0x12, 0xF0, 0x00, 0x00, 0x80, 0x10, 0x9C, 0x0C, 0x94, 0x65, 0x65, 0xF0, 0xF0, 0x71, 0x04, 0x04, 0x00, 0x10, 0x80,
+    0x04, 0x16, 0x13, 0x40, 0x70, 0x80, 0x80, 0x00, 0x02, 0x71, 0x00, 0x00, 0x48, 0xF9, 0x09, 0x08, 0x89, 0x06, 0x06, 0x0F, 0x0F, 0x0E,
+    0x04, 0x2D, 0x02, 0x0F, 0x0F,
+    0x05, 0x16, 0x0F, 0x20, 0x20, 0x00, 0x01, 0x01, 0x01, 0x07, 0xE0, 0xE0, 0xF0, 0x30, 0x10, 0x10, 0x31, 0xC0,
+    0x05, 0x29, 0x04, 0x20, 0x70, 0xF0, 0xF0,
+    0x06, 0x13, 0x23, 0x1E, 0x1F, 0x3F, 0x3F, 0x3E, 0xF0, 0xFE, 0xFE, 0x6E, 0x00, 0x10, 0x17, 0x10, 0x0E, 0x1E, 0xFE, 0xEF, 0xE1, 0xE0, 0xF1, 0xF1, 0xE1, 0x01, 0x00, 0x00, 0x10, 0x6F, 0xEF, 0xDF, 0x9F, 0x1C, 0x08, 0x10, 0x10, 0x20,
+    0x07, 0x15, 0x21, 0x10, 0x10, 0xD0, 0xE0, 0x10, 0x10, 0x11, 0x11, 0x1E, 0x1E, 0x07, 0x03, 0x80, 0x0F, 0xEC, 0x00, 0x00, 0x01, 0x05, 0xED, 0xEC, 0xED, 0xED, 0x7D, 0x3F, 0x1F, 0x0D, 0x2D, 0xFF, 0xFE, 0xFE, 0xFE, 0x1E,
+    LCD_DELTA_END
+};
+
+// 第2幀 -> 第3幀：12段，每段 page, x, len, XOR資料
+static const uint8_t green_walk_d1[199] = {
+    0x00, 0x10, 0x05, 0x80, 0x80, 0x80, 0x80, 0x08,
+    0x00, 0x1B, 0x03, 0x08, 0x78, 0x80,
+    0x01, 0x0E, 0x06, 0x06, 0x01, 0x08, 0x08, 0x08, 0x78,
+    0x01, 0x1C, 0x07, 0xF0, 0x98, 0x81, 0x87, 0x87, 0x07, 0x04,
+    0x02, 0x17, 0x01, 0xF8,
+    0x02, 0x20, 0x08, 0x01, 0x07, 0x08, 0x08, 0xF0, 0xF0, 0x80, 0x80,
+    0x03, 0x17, 0x16, 0x0F, 0x08, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x90, 0x9C, 0x0C, 0x0C, 0x04, 0x04, 0x08, 0x08, 0xF1, 0x00, 0x0C, 0x00, 0xF0,
+    0x04, 0x16, 0x17, 0x70, 0x78, 0x80, 0x80, 0x04, 0x01, 0x01, 0x70, 0x70, 0x70, 0xF1, 0x01, 0x00, 0x00, 0x88, 0x88, 0x08, 0x00, 0xF3, 0x08, 0x08, 0x08, 0x0F,
+    0x05, 0x16, 0x09, 0xC0, 0xC0, 0x00, 0x01, 0x09, 0x0D, 0xE0, 0x10, 0x10,
+    0x05, 0x23, 0x09, 0xF0, 0xC1, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80,
+    0x06, 0x13, 0x23, 0x1E, 0x1F, 0x3F, 0x3F, 0x3F, 0xF0, 0xFE, 0xFE, 0xFE, 0x9F, 0x9E, 0x90, 0x90, 0x90, 0x10, 0xF0, 0xF0, 0xF0, 0x00, 0x01, 0x01, 0x0E, 0xF0, 0xF0, 0xC0, 0x03, 0xF7, 0xE7, 0xCF, 0x8F, 0x8C, 0x88, 0x90, 0xE0, 0xE0,
+    0x07, 0x14, 0x22, 0x90, 0x00, 0x00, 0x80, 0xF0, 0x00, 0x00, 0x80, 0xC0, 0x07, 0x87, 0xE3, 0xE1, 0x60, 0xEF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFE, 0x7E, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    LCD_DELTA_END
+};
+
+// 第3幀 -> 第4幀：13段，每段 page, x, len, XOR資料
+static const uint8_t green_walk_d2[191] = {
+    0x00, 0x0F, 0x01, 0x80,
+    0x00, 0x14, 0x01, 0x08,
+    0x00, 0x1B, 0x05, 0x08, 0x70, 0x00, 0x80, 0x80,
+    0x01, 0x0E, 0x06, 0x06, 0x09, 0x00, 0x00, 0x00, 0x70,
+    0x01, 0x1C, 0x04, 0x70, 0x10, 0x19, 0x0F,
+    0x02, 0x20, 0x09, 0x01, 0x80, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x80,
+    0x03, 0x15, 0x07, 0x80, 0x80, 0x80, 0x88, 0x80, 0x80, 0x70,
+    0x03, 0x21, 0x0C, 0x0F, 0x0F, 0x0E, 0x06, 0x06, 0x00, 0x00, 0xF9, 0x03, 0x0E, 0x08, 0xF0,
+    0x04, 0x15, 0x0B, 0x03, 0x73, 0x7F, 0x7F, 0x7F, 0xFF, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+    0x04, 0x24, 0x09, 0x38, 0x38, 0x08, 0x08, 0xF3, 0xFC, 0x00, 0x00, 0x03,
+    0x05, 0x18, 0x14, 0xF0, 0x30, 0x38, 0x1C, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xF0, 0xF0, 0x00, 0x7E, 0x7E, 0xF0, 0xF0, 0xEF, 0xCF, 0x80, 0x80,
+    0x06, 0x16, 0x1F, 0x1E, 0x1F, 0x10, 0x10, 0x08, 0x10, 0x70, 0x82, 0x88, 0x80, 0x70, 0xF0, 0xF0, 0xF1, 0xF7, 0x0F, 0x1F, 0x1F, 0x30, 0xF1, 0xFF, 0xCF, 0x8C, 0x88, 0x08, 0x00, 0x00, 0x80, 0x90, 0xB0, 0x80,
+    0x07, 0x14, 0x23, 0x70, 0xF0, 0xF0, 0x70, 0xEE, 0xEE, 0xEE, 0x6E, 0xEE, 0xE7, 0x67, 0x03, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x0C, 0x0E, 0x0E, 0x8E, 0x6F, 0x6F, 0xFF, 0xEF, 0xEF, 0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0x08,
+    LCD_DELTA_END
+};
+
+// 第4幀 -> 第5幀：10段，每段 page, x, len, XOR資料
+static const uint8_t green_walk_d3[268] = {
+    0x00, 0x0E, 0x12, 0x80, 0x70, 0x70, 0x78, 0x78, 0x70, 0x08, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0x80, 0x80, 0x80,
+    0x01, 0x0B, 0x15, 0x0E, 0x0E, 0x0E, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xF0, 0xF0, 0xF1, 0x7F, 0x1F, 0x1F, 0x0F,
+    0x02, 0x13, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x1C, 0x0C, 0x8F, 0x0F, 0x0F, 0x0F, 0x0F, 0x88, 0x08, 0x08, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0x0E, 0x24, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x70, 0x70, 0x70, 0x70, 0x0F, 0x0E, 0x0E, 0x3E, 0xFE, 0xF1, 0xF3, 0xF6, 0x0E, 0x0E, 0x08, 0x38, 0xF8, 0x0F, 0x0E, 0x08, 0x00, 0xF0, 0xF0, 0xE0, 0xE0, 0x40,
+    0x04, 0x09, 0x25, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x02, 0x02, 0x06, 0x06, 0x06, 0x04, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x70, 0xF8, 0xF0, 0xF4, 0x08, 0x08, 0x00, 0x01,
+    0x05, 0x14, 0x21, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0x3E, 0xFE, 0xDF, 0xDF, 0x0F, 0x0F, 0x01, 0xFE, 0xFE, 0xFE, 0xF8, 0x7E, 0x7E, 0xF0, 0xF1, 0xEF, 0xEF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0x06, 0x13, 0x22, 0x7C, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xE0, 0xF9, 0x69, 0x0E, 0xFC, 0xF8, 0xF0, 0xE0, 0xF0, 0xF0, 0xF1, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0xFE, 0xF0, 0x10, 0x80, 0x81, 0x03, 0x13, 0x17, 0x0F, 0x1F, 0x3F, 0x7F,
+    0x07, 0x0A, 0x1A, 0x06, 0x1E, 0x1E, 0x1E, 0x0E, 0x0E, 0x0E, 0x1E, 0x1E, 0x0E, 0x1F, 0x1F, 0x1F, 0x0F, 0xE1, 0xE1, 0xE1, 0xE1, 0x21, 0x00, 0x00, 0x10, 0x07, 0x03, 0x01, 0x01,
+    0x07, 0x28, 0x0F, 0x70, 0xF0, 0xF0, 0xF0, 0x00, 0x81, 0x03, 0x08, 0x08, 0xCF, 0xE0, 0xE0, 0xE0, 0x7F, 0x08,
+    LCD_DELTA_END
+};
+
+// 第5幀 -> 第6幀：12段，每段 page, x, len, XOR資料
+static const uint8_t green_walk_d4[258] = {
+    0x00, 0x0E, 0x11, 0x80, 0xF0, 0xF0, 0x38, 0x38, 0x00, 0x08, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0xC0, 0xC0,
+    0x01, 0x0B, 0x16, 0x0E, 0x0E, 0x0E, 0xFF, 0xF9, 0xF9, 0xF8, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x00, 0xE0, 0xF0, 0xF0, 0xF1, 0xFF, 0x9F, 0x8F, 0x06, 0x06,
+    0x02, 0x13, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x1C, 0x09, 0x8F, 0x0F, 0x0F, 0x8F, 0x88, 0x88, 0x08, 0x08, 0x38,
+    0x03, 0x0E, 0x24, 0xF0, 0x70, 0x70, 0x30, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x0E, 0x0E, 0x3E, 0xE1, 0xF1, 0xF3, 0xF7, 0x30, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x0C, 0x0C, 0x08, 0xF0, 0xF0, 0xE0, 0xE0, 0x40,
+    0x04, 0x09, 0x25, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x01, 0x01, 0x01, 0xF1, 0xF9, 0xF9, 0x7C, 0x80, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x00, 0x17, 0xB0, 0x30, 0x70, 0xF0, 0x67, 0x08, 0x08, 0x08, 0x04, 0x01,
+    0x05, 0x12, 0x23, 0xE0, 0xF0, 0x00, 0x00, 0x1E, 0x83, 0x01, 0x01, 0xC1, 0xF1, 0x30, 0xF0, 0xF0, 0xF1, 0x0F, 0x0F, 0x0E, 0x08, 0x11, 0x00, 0x00, 0x01, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x10, 0xE0,
+    0x06, 0x12, 0x13, 0x07, 0x7B, 0xE0, 0xE0, 0xE0, 0x8F, 0x8F, 0x87, 0x86, 0x16, 0xF0, 0xF8, 0x78, 0x60, 0x80, 0x08, 0x08, 0x08, 0x60,
+    0x06, 0x2A, 0x06, 0x19, 0x99, 0x09, 0x0E, 0x0C, 0x84,
+    0x06, 0x34, 0x01, 0xFF,
+    0x07, 0x0A, 0x1A, 0x06, 0x1E, 0x1E, 0x1E, 0x02, 0x02, 0x01, 0x11, 0x12, 0x0E, 0x10, 0x70, 0x73, 0x0F, 0x90, 0x90, 0x93, 0x99, 0x50, 0x00, 0x11, 0x01, 0x01, 0x00, 0x02, 0x02,
+    0x07, 0x2C, 0x09, 0x60, 0xE2, 0xE0, 0xF8, 0xF8, 0x31, 0x10, 0x10, 0x1F,
+    LCD_DELTA_END
+};
+
+// 第6幀 -> 第1幀：9段，每段 page, x, len, XOR資料
+static const uint8_t green_walk_d5[246] = {
+    0x00, 0x11, 0x10, 0x40, 0x40, 0x70, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x40, 0x60, 0x40, 0x40, 0x80, 0x80,
+    0x01, 0x0F, 0x12, 0x08, 0x08, 0x08, 0x00, 0x70, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0xF8, 0x90, 0x80, 0x01, 0x05,
+    0x02, 0x17, 0x01, 0xFF,
+    0x02, 0x1F, 0x0A, 0x80, 0x80, 0x80, 0x00, 0x00, 0xB8, 0x80, 0x00, 0x00, 0x80,
+    0x03, 0x0F, 0x1F, 0x80, 0x80, 0xC0, 0xC0, 0xF0, 0xF0, 0xF0, 0xF0, 0x7F, 0x70, 0x70, 0x70, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x9F, 0x0F, 0x0F, 0x97, 0x59, 0x69, 0xF0, 0xF0, 0x81, 0x04, 0x04, 0x0C, 0x18, 0x80,
+    0x04, 0x0F, 0x20, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x40, 0x80, 0x80, 0x80, 0x83, 0x83, 0x70, 0x70, 0x71, 0xB8, 0x88, 0x88, 0x08, 0x81, 0x06, 0x86, 0x0F, 0x0F, 0x99, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x0F,
+    0x05, 0x12, 0x22, 0xE0, 0xF0, 0xF0, 0xF0, 0x06, 0x9F, 0x0F, 0x0F, 0x0F, 0x3E, 0xF7, 0xF0, 0xF0, 0xF1, 0x31, 0x11, 0x10, 0x31, 0x10, 0x01, 0x00, 0x00, 0x1F, 0x10, 0x00, 0x00, 0x10, 0xF0, 0xF0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0,
+    0x06, 0x12, 0x24, 0x07, 0x07, 0x1F, 0x1F, 0x1F, 0x71, 0x7F, 0x77, 0x77, 0xFF, 0x11, 0x08, 0x8F, 0x90, 0x8E, 0x06, 0x06, 0x17, 0x81, 0xE0, 0xF0, 0xF0, 0xE0, 0xFE, 0xE6, 0x86, 0x16, 0x9F, 0x0F, 0x87, 0x07, 0x1F, 0x0F, 0x0F, 0xF0, 0xC0,
+    0x07, 0x0E, 0x28, 0x0C, 0x0C, 0x0F, 0x0F, 0x0C, 0x00, 0xEF, 0x8F, 0x8C, 0x20, 0x8F, 0x8F, 0x8C, 0x87, 0x4E, 0xFE, 0xEF, 0xF6, 0xFA, 0xFC, 0xFC, 0x0F, 0x00, 0x00, 0x01, 0x05, 0xED, 0xEC, 0xED, 0xED, 0x7D, 0x3C, 0x1C, 0x0D, 0x2D, 0xEE, 0xEE, 0xEE, 0xE1, 0x01,
+    LCD_DELTA_END
+};
+
+static const uint8_t * const green_walk_delta[6] = {
+    green_walk_d0, green_walk_d1, green_walk_d2, green_walk_d3, green_walk_d4, green_walk_d5
+};
+
+static const LcdDeltaAnim green_walk = { 64, 8, 6, green_walk_key, green_walk_delta };
+
+#endif
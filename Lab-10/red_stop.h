@@ -0,0 +1,19 @@
+// 由 Tools/Bmp2Lcd 產生，請勿手動修改：
+//   bmp2lcd -r -n red -o Lab-10/red_stop.h Lab-10/docs/red.bmp
+
+#ifndef __RED_STOP_H__
+#define __RED_STOP_H__
+
+// red.bmp: 64x64，24-bpp，門檻值，8頁x64位元組
+// RLE：512 -> 103 位元組，以 LCD_rleDraw(x, page, red_rle, 64, 8) 繪製
+const unsigned char red_rle[103] = {
+    0x97, 0x00, 0x81, 0xC0, 0x00, 0x1E, 0x81, 0xDE, 0x00, 0x1E, 0x81, 0xC0, 0xAF, 0x00, 0x04, 0x3F,
+    0x3F, 0x3D, 0x3D, 0x84, 0x81, 0xBD, 0x04, 0x84, 0x3D, 0x3D, 0x3F, 0x3F, 0xA7, 0x00, 0x80, 0x80,
+    0x85, 0xB8, 0x00, 0x80, 0x83, 0xBB, 0x00, 0x80, 0x84, 0xB8, 0x82, 0x80, 0x99, 0x00, 0x81, 0xF8,
+    0x00, 0x00, 0x81, 0x7B, 0x81, 0x03, 0x8A, 0x7B, 0x81, 0x03, 0x81, 0x7B, 0x01, 0x03, 0xFB, 0x80,
+    0xF8, 0x96, 0x00, 0x81, 0x73, 0x86, 0x00, 0x8A, 0x77, 0x86, 0x00, 0x81, 0x73, 0xA3, 0x00, 0x81,
+    0xFF, 0x82, 0x0F, 0x81, 0xFF, 0xAB, 0x00, 0x87, 0xEE, 0x80, 0x00, 0x86, 0xEE, 0x9F, 0x00, 0x8F,
+    0x0E, 0x80, 0x00, 0x8F, 0x0E, 0x89, 0x00
+};
+
+#endif
@@ -31,6 +31,10 @@
 #include "SYS_init.h"          // 系統初始化函數
 #include "Seven_Segment.h"      // 七段顯示器控制函數
 #include "Scankey.h"           // 按鍵掃描函數
+#include "Segment_Scan.h"       // 七段顯示器背景掃描引擎（Timer2）
+
+// 按鍵掃描間隔（5ms）
+#define KEY_POLL_TICKS (SEG_SCAN_TICK_HZ / 200)
 
 /*
  * ================================================================
@@ -62,33 +66,8 @@ void Init_GPIO(void)
  */
 void Display_7seg(uint16_t value)
 {
-    uint8_t digit;
-
-    // 顯示千位數
-    digit = value / 1000;
-    CloseSevenSegment();
-    ShowSevenSegment(3, digit);
-    CLK_SysTickDelay(200);
-
-    // 顯示百位數
-    value %= 1000;
-    digit = value / 100;
-    CloseSevenSegment();
-    ShowSevenSegment(2, digit);
-    CLK_SysTickDelay(200);
-
-    // 顯示十位數
-    value %= 100;
-    digit = value / 10;
-    CloseSevenSegment();
-    ShowSevenSegment(1, digit);
-    CLK_SysTickDelay(200);
-
-    // 顯示個位數
-    digit = value % 10;
-    CloseSevenSegment();
-    ShowSevenSegment(0, digit);
-    CLK_SysTickDelay(200);
+    // 只更新顯示緩衝區，多工掃描由Timer2中斷負責
+    Segment_showNumber(value);
 }
 
 /*
@@ -212,71 +191,82 @@ int main(void)
 {
     struct TrafficSignal ts;    // 交通號誌結構體
     int key = 0, last_key = 0;  // 按鍵變數
-    int tick = 0;               // 時鐘計數器
+    uint32_t second_tick;       // 上次倒數時的掃描tick
+    uint32_t key_tick = 0;      // 上次掃描按鍵時的掃描tick
+    int shown_timer = -1;       // 已顯示的倒數值（-1=尚未顯示）
 
     // ================================================================
     // 系統初始化階段
     // ================================================================
     SYS_Init();                 // 系統初始化
     Init_GPIO();                // GPIO初始化
-    OpenSevenSegment();         // 開啟七段顯示器
+    Segment_scanInit();         // 開啟七段顯示器與背景掃描
     OpenKeyPad();               // 開啟按鍵掃描
 
     // 初始化交通號誌：綠燈8秒，黃燈5秒，紅燈13秒
     TrafficSignal_initialize(&ts, 8, 5, 13);
+    second_tick = Segment_scanTicks();
 
     // ================================================================
     // 主程式迴圈
     // ================================================================
     while (1)
     {
-        key = ScanKey();        // 掃描按鍵狀態
-        
-        // 處理按鍵事件（避免重複觸發）
-        if (key != 0 && key != last_key)
+        // 每5ms掃描一次按鍵（主迴圈不再被顯示延遲拖慢，需控制掃描間隔避免彈跳重複觸發）
+        if ((Segment_scanTicks() - key_tick) >= KEY_POLL_TICKS)
         {
-            last_key = key;
-            switch (key)
+            key_tick = Segment_scanTicks();
+            key = ScanKey();        // 掃描按鍵狀態
+
+            // 處理按鍵事件（避免重複觸發）
+            if (key != 0 && key != last_key)
+            {
+                last_key = key;
+                switch (key)
+                {
+                case 1:
+                    // 按鍵1：強制綠燈
+                    ts.state = GREEN;
+                    ts.timer = ts.greenDuration;
+                    break;
+                case 2:
+                    // 按鍵2：強制黃燈
+                    ts.state = YELLOW;
+                    ts.timer = ts.yellowDuration;
+                    break;
+                case 3:
+                    // 按鍵3：強制紅燈
+                    ts.state = RED;
+                    ts.timer = ts.redDuration;
+                    break;
+                case 9:
+                    // 按鍵9：增加5秒倒數時間
+                    ts.timer += 5;
+                    if (ts.timer > 99) ts.timer = 99;  // 限制最大值
+                    break;
+                default:
+                    break;
+                }
+            }
+            else if (key == 0)
             {
-            case 1:
-                // 按鍵1：強制綠燈
-                ts.state = GREEN;
-                ts.timer = ts.greenDuration;
-                break;
-            case 2:
-                // 按鍵2：強制黃燈
-                ts.state = YELLOW;
-                ts.timer = ts.yellowDuration;
-                break;
-            case 3:
-                // 按鍵3：強制紅燈
-                ts.state = RED;
-                ts.timer = ts.redDuration;
-                break;
-            case 9:
-                // 按鍵9：增加5秒倒數時間
-                ts.timer += 5;
-                if (ts.timer > 99) ts.timer = 99;  // 限制最大值
-                break;
-            default:
-                break;
+                last_key = 0;       // 重置按鍵狀態
             }
         }
-        else if (key == 0)
+
+        // 更新顯示（倒數值改變時才寫入緩衝區）
+        if (ts.timer != shown_timer)
         {
-            last_key = 0;       // 重置按鍵狀態
+            Display_7seg(ts.timer); // 顯示倒數時間
+            shown_timer = ts.timer;
         }
-
-        // 更新顯示
-        Display_7seg(ts.timer); // 顯示倒數時間
         Show_LED(ts.state);     // 顯示LED狀態
 
-        // 時鐘計數器處理
-        tick++;
-        if (tick >= 900)        // 約1秒（900個週期）
+        // 以掃描tick計時，每1秒倒數一次（不受主迴圈速度影響）
+        if ((Segment_scanTicks() - second_tick) >= SEG_SCAN_TICK_HZ)
         {
+            second_tick += SEG_SCAN_TICK_HZ;
             TrafficSignal_countDown(&ts);  // 執行倒數計時
-            tick = 0;           // 重置計數器
         }
     }
 }
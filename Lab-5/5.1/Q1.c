@@ -20,7 +20,7 @@
  * 3. 密碼正確：LED跑馬燈效果 + 成功提示
  * 4. 密碼錯誤：蜂鳴器響聲 + 錯誤提示
  * 5. 支援重新產生密碼和清除輸入
- * 6. 最多4次嘗試機會
+ * 6. 嘗試紀錄在LCD上捲動顯示（最新8筆），不限次數
  *
  * 按鍵對應：
  * - 按鍵1-6: 輸入數字1-6
@@ -39,11 +39,14 @@
 #include "LCD.h"                // LCD顯示器控制函數
 #include "Scankey.h"           // 按鍵掃描函數
 #include "Seven_Segment.h"      // 七段顯示器控制函數
+#include "Segment_Scan.h"       // 七段顯示器背景掃描引擎（Timer2）
+#include "LCD_Console.h"        // 硬體捲動文字主控台（嘗試紀錄）
 
 // ================================================================
 // 常數定義
 // ================================================================
 #define SEED_STORAGE_ADDRESS 0x10000 // 種子儲存位址（範例位址，確保不與程式儲存區域衝突）
+#define KEY_POLL_TICKS (SEG_SCAN_TICK_HZ / 200) // 按鍵掃描間隔（5ms）
 
 // ================================================================
 // 全域變數
@@ -53,7 +56,7 @@ char input_password[5] = "";           // 使用者輸入的密碼
 int input_count = 0;                   // 輸入字元計數器
 int password_set = 0;                  // 密碼是否已設定的標記
 int display_password[4] = {0, 0, 0, 0}; // 用於七段顯示器的密碼陣列
-int attempt_count = 0;                 // 嘗試次數計數器（最多4次）
+int attempt_count = 0;                 // 嘗試次數計數器
 static uint32_t entropy_accumulator = 0; // 熵累積器，用於產生隨機數
 
 /*
@@ -78,32 +81,19 @@ void Buzz(int number)
 /*
  * ================================================================
  * 七段顯示器密碼顯示函數
- * 功能：持續在七段顯示器上顯示密碼
+ * 功能：將密碼寫入七段顯示器緩衝區，由Timer2中斷持續掃描顯示
  * ================================================================
  */
 void DisplayPasswordOn7Segment(void)
 {
     // 只有在密碼已設定時才顯示
     if(password_set) {
-        // 顯示最右邊的數字（個位數）
-        ShowSevenSegment(0, display_password[3]);
-        CLK_SysTickDelay(5000);
-        CloseSevenSegment();
-        
-        // 顯示十位數
-        ShowSevenSegment(1, display_password[2]);
-        CLK_SysTickDelay(5000);
-        CloseSevenSegment();
-        
-        // 顯示百位數
-        ShowSevenSegment(2, display_password[1]);
-        CLK_SysTickDelay(5000);
-        CloseSevenSegment();
-        
-        // 顯示最左邊的數字（千位數）
-        ShowSevenSegment(3, display_password[0]);
-        CLK_SysTickDelay(5000);
-        CloseSevenSegment();
+        Segment_setDigit(0, display_password[3]);  // 最右邊的數字（個位數）
+        Segment_setDigit(1, display_password[2]);  // 十位數
+        Segment_setDigit(2, display_password[1]);  // 百位數
+        Segment_setDigit(3, display_password[0]);  // 最左邊的數字（千位數）
+    } else {
+        Segment_clear();
     }
 }
 
@@ -161,12 +151,13 @@ void GenerateRandomPassword(void)
     }
     correct_password[4] = '\0';        // 字串結尾
     password_set = 1;                  // 標記密碼已設定
+    DisplayPasswordOn7Segment();       // 更新七段顯示器緩衝區
     
     // 更新熵值供下次使用
     entropy_accumulator ^= final_seed;
     
     // 清除LCD並重置嘗試次數
-    clear_LCD();
+    LCD_consoleClear();
     attempt_count = 0;
 }
 
@@ -238,27 +229,23 @@ void VerifyPassword(void)
 {
     char display_line[17]; // LCD行緩衝區
     
-    // 檢查是否超過最大嘗試次數
-    if(attempt_count >= 4) {
-        return; // 超過嘗試次數，不執行任何動作
-    }
-    
     // 檢查是否有輸入
+    // 有輸入時最下方一行是輸入中的密碼，結果接在後面（只送出改變的字元）
     if(input_count == 0) {
-        // 沒有輸入 - 顯示NULL
+        // 沒有輸入 - 新的一行顯示NULL
         sprintf(display_line, " NULL");
-        print_Line(attempt_count, display_line);
+        LCD_consolePrint(display_line);
     }
     else if(strcmp(input_password, correct_password) == 0) {
         // 密碼正確 - 左邊顯示輸入，右邊顯示PASS
         sprintf(display_line, "%s PASS", input_password);
-        print_Line(attempt_count, display_line);
+        LCD_consoleUpdate(display_line);
         RunningLight(); // 執行LED跑馬燈
     }
     else {
         // 密碼錯誤 - 左邊顯示輸入，右邊顯示ERROR
         sprintf(display_line, "%s ERROR", input_password);
-        print_Line(attempt_count, display_line);
+        LCD_consoleUpdate(display_line);
         Buzz(1); // 蜂鳴器響一聲
     }
     
@@ -275,6 +262,7 @@ void VerifyPassword(void)
 int main(void)
 {
     uint8_t keyin, last_key = 0;       // 按鍵輸入和上次按鍵
+    uint32_t key_tick = 0;             // 上次掃描按鍵時的掃描tick
     int i;
     
     // ================================================================
@@ -307,8 +295,8 @@ int main(void)
     // ================================================================
     init_LCD();                        // 初始化LCD
     clear_LCD();                       // 清除LCD
-    OpenSevenSegment();                // 初始化七段顯示器
-    clear_LCD();                       // 再次清除LCD
+    Segment_scanInit();                // 初始化七段顯示器與背景掃描
+    LCD_consoleInit(1);                // 嘗試紀錄主控台（清除LCD，平滑捲動）
     OpenKeyPad();                      // 初始化3x3按鍵矩陣
     
     // ================================================================
@@ -319,10 +307,11 @@ int main(void)
         // 持續從系統狀態累積熵值
         AccumulateEntropy();
         
-        // 持續在七段顯示器上顯示密碼
-        DisplayPasswordOn7Segment();
-        
-        // 掃描按鍵矩陣輸入
+        // 七段顯示器由Timer2中斷在背景掃描，主迴圈不再等待；
+        // 每5ms掃描一次按鍵矩陣（避免彈跳造成重複觸發）
+        if((Segment_scanTicks() - key_tick) < KEY_POLL_TICKS) continue;
+        key_tick = Segment_scanTicks();
+        LCD_consoleTick();             // 紀錄捲動中時起始行前進1列（8次共40ms）
         keyin = ScanKey();
         
         // 只有在按鍵被按下且與上次不同時才處理
@@ -331,13 +320,14 @@ int main(void)
             entropy_accumulator ^= (keyin << 24) | SysTick->VAL;
             
             if(keyin >= 1 && keyin <= 6) {
-                // 密碼輸入(1-6) - 只有在少於4位數、密碼已設定且未超過嘗試次數時才接受
-                if(input_count < 4 && password_set && attempt_count < 4) {
+                // 密碼輸入(1-6) - 只有在少於4位數且密碼已設定時才接受
+                if(input_count < 4 && password_set) {
                     input_password[input_count] = '0' + keyin;
                     input_count++;
                     input_password[input_count] = '\0';
-                    // 顯示當前輸入（尚未永久儲存）
-                    print_Line(attempt_count, input_password);
+                    // 顯示當前輸入（尚未永久儲存）：第一個數字開始新的一行
+                    if(input_count == 1) LCD_consolePrint(input_password);
+                    else LCD_consoleUpdate(input_password);
                 }
             }
             else if(keyin == 7) { // R鍵
@@ -347,20 +337,18 @@ int main(void)
             }
             else if(keyin == 8) { // C鍵
                 // 清除LCD螢幕並重置所有內容
-                clear_LCD();
+                LCD_consoleClear();
                 ClearInput();
                 attempt_count = 0;
             }
             else if(keyin == 9) { // O鍵
                 // 驗證密碼
-                if(password_set && attempt_count < 4) {
+                if(password_set) {
                     VerifyPassword();
-                } else if(!password_set) {
-                    if(attempt_count < 4) {
-                        print_Line(attempt_count, " NULL");
-                        attempt_count++;
-                        ClearInput();
-                    }
+                } else {
+                    LCD_consolePrint(" NULL");
+                    attempt_count++;
+                    ClearInput();
                 }
             }
         }
@@ -40,12 +40,13 @@
 #include "LCD.h"                // LCD顯示器控制函數
 #include "Scankey.h"           // 按鍵掃描函數
 #include "Seven_Segment.h"      // 七段顯示器控制函數
+#include "Segment_Glyph.h"      // 七段顯示器接線與字形定義
 
 // ================================================================
 // 常數定義
 // ================================================================
-#define MINUS_CODE 16           // 負號"-"的顯示代碼
-#define SEG_BLANK 0xFF          // 空白顯示代碼
+#define MINUS_CODE SEG_GLYPH_MINUS_CODE // 負號"-"的顯示代碼
+#define SEG_BLANK  SEG_GLYPH_BLANK      // 空白顯示代碼
 
 /*
  * ================================================================
@@ -94,11 +95,30 @@ static void lcd_show_bin(unsigned char N){
 static unsigned char dig[4]={0,0,0,0};    // 七段顯示器數字陣列
 static unsigned char mask[4]={0,0,0,0};   // 七段顯示器遮罩陣列
 
+/*
+ * ================================================================
+ * 十進位拆解函數（不使用除法）
+ * 功能：將0-255拆成百、十、個位數
+ * 說明：Cortex-M0 無硬體除法器，百位以比較取得，
+ *       十位以 (a*205)>>11 取代 a/10（a<1029時結果相同）
+ * ================================================================
+ */
+static void split_dec(unsigned int a, unsigned char* h, unsigned char* t, unsigned char* o){
+    unsigned char hh = 0;
+
+    if(a >= 200){ hh = 2; a -= 200; }
+    else if(a >= 100){ hh = 1; a -= 100; }
+
+    *h = hh;
+    *t = (unsigned char)((a * 205) >> 11);
+    *o = (unsigned char)(a - (unsigned int)(*t) * 10);
+}
+
 /*
  * ================================================================
  * 無符號整數轉換函數
  * 功能：將無符號整數轉換為七段顯示器格式
- * 參數：v - 要轉換的無符號整數
+ * 參數：v - 要轉換的無符號整數(0-255)
  * ================================================================
  */
 static void make_digits_U(unsigned int v){
@@ -113,57 +133,42 @@ static void make_digits_U(unsigned int v){
         return;
     }
     
-    // 從個位數開始轉換
-    dig[0]=(unsigned char)(v%10); mask[0]=1; v/=10;
-    if(v>0){ dig[1]=(unsigned char)(v%10); mask[1]=1; v/=10; }
-    if(v>0){ dig[2]=(unsigned char)(v%10); mask[2]=1; v/=10; }
-    if(v>0){ dig[3]=(unsigned char)(v%10); mask[3]=1; }
+    // 拆解為百、十、個位數，前導0不顯示
+    split_dec(v, &dig[2], &dig[1], &dig[0]);
+    mask[0]=1;
+    if(v>=10)  mask[1]=1;
+    if(v>=100) mask[2]=1;
 }
 
 /*
  * ================================================================
  * 有符號整數轉換函數
  * 功能：將有符號整數轉換為七段顯示器格式
- * 參數：val - 要轉換的有符號整數
+ * 參數：val - 要轉換的有符號整數(-128至127)
  * ================================================================
  */
 static void make_digits_S(int val){
     int neg = (val < 0);                    // 檢查是否為負數
     unsigned int a = (unsigned int)(neg ? -val : val); // 取得絕對值
-    int i, idx;
+    int i, width;
+    unsigned char h, t, o;
+    
+    // 正數與無符號整數格式相同
+    if(!neg){
+        make_digits_U(a);
+        return;
+    }
     
     // 初始化所有數字和遮罩
     for(i=0;i<4;i++){ dig[i]=0; mask[i]=0; }
     
-    if(!neg){
-        // 正數處理
-        if(a==0){
-            dig[0]=0; dig[1]=0; mask[0]=1; mask[1]=1;
-            return;
-        }
-        idx = 0;
-        while(a>0 && idx<4){
-            dig[idx] = a % 10;
-            mask[idx]=1;
-            a/=10;
-            idx++;
-        }
-    }else{
-        // 負數處理，顯示負號
-        if(a >= 100){
-            dig[3]=MINUS_CODE; mask[3]=1;
-            dig[2]=(a/100)%10; mask[2]=1;
-            dig[1]=(a/10)%10; mask[1]=1;
-            dig[0]=a%10; mask[0]=1;
-        }else if(a >=10){
-            dig[2]=MINUS_CODE; mask[2]=1;
-            dig[1]=a/10; mask[1]=1;
-            dig[0]=a%10; mask[0]=1;
-        }else{
-            dig[1]=MINUS_CODE; mask[1]=1;
-            dig[0]=a; mask[0]=1;
-        }
-    }
+    // 負數處理，負號放在最高有效位數的左邊
+    split_dec(a, &h, &t, &o);
+    width = (a >= 100) ? 3 : (a >= 10) ? 2 : 1;
+    dig[0]=o; mask[0]=1;
+    if(width >= 2){ dig[1]=t; mask[1]=1; }
+    if(width >= 3){ dig[2]=h; mask[2]=1; }
+    dig[width]=MINUS_CODE; mask[width]=1;
 }
 
 /*
@@ -185,6 +190,33 @@ static void make_digits_X(unsigned char v){
     mask[0]=1; mask[1]=1;                 // 啟用兩個數字
 }
 
+// ================================================================
+// 顯示快取：記錄目前畫面對應的(數值, 模式)
+// ================================================================
+static unsigned char shown_N=0, shown_mode=0;
+static unsigned char shown_valid=0;       // 0=尚未顯示過
+
+/*
+ * ================================================================
+ * 快取顯示函數
+ * 功能：LCD二進制只在數值改變時重畫，七段顯示器數字只在數值或模式改變時重算
+ * 參數：N - 8位元數值, mode - 0=U, 1=S, 2=X
+ * ================================================================
+ */
+static void render_value(unsigned char N, unsigned char mode){
+    if(shown_valid && N==shown_N && mode==shown_mode) return;
+    
+    // 二進制只與數值有關，切換模式不必重畫LCD
+    if(!shown_valid || N!=shown_N) lcd_show_bin(N);
+    
+    // 根據模式轉換數值
+    if(mode==0) make_digits_U(N);           // 無符號整數
+    else if(mode==1) make_digits_S((signed char)N); // 有符號整數
+    else make_digits_X(N);                  // 十六進制
+    
+    shown_N=N; shown_mode=mode; shown_valid=1; // 記錄目前畫面
+}
+
 /*
  * ================================================================
  * 七段顯示器刷新函數
@@ -219,7 +251,6 @@ static void refresh_once(void){
 int main(void){
     unsigned char N=0, mode=0;             // 數值和顯示模式
     unsigned char k=0, prev_k=0;           // 當前和上次按鍵
-    unsigned char prev_mode=255, prev_N=255; // 上次模式和數值
     
     // ================================================================
     // 系統初始化
@@ -228,11 +259,10 @@ int main(void){
     init_LCD();                            // 初始化LCD
     clear_LCD();                           // 清除LCD
     OpenKeyPad();                          // 初始化按鍵矩陣
-    CloseSevenSegment();                   // 關閉七段顯示器
+    OpenSevenSegment();                    // 初始化七段顯示器（含DMASK寫入遮罩）
     
     // 初始顯示
-    lcd_show_bin(N);                       // 顯示初始數值的二進制
-    make_digits_U(N);                      // 設定為無符號整數模式
+    render_value(N, mode);                 // 顯示初始數值（無符號整數模式）
     
     // ================================================================
     // 主程式迴圈
@@ -265,17 +295,8 @@ int main(void){
         // 顯示更新
         // ================================================================
         
-        // 如果N或模式改變，更新LCD和七段顯示器
-        if(N!=prev_N || mode!=prev_mode){
-            lcd_show_bin(N);               // 更新LCD二進制顯示
-            
-            // 根據模式轉換數值
-            if(mode==0) make_digits_U(N);           // 無符號整數
-            else if(mode==1) make_digits_S((signed char)N); // 有符號整數
-            else make_digits_X(N);                  // 十六進制
-            
-            prev_N=N; prev_mode=mode;       // 記錄當前狀態
-        }
+        // 只有N或模式改變時才重新計算（由render_value()的快取判斷）
+        render_value(N, mode);
         
         refresh_once();                     // 刷新七段顯示器
         prev_k=k;                           // 記錄當前按鍵
@@ -20,7 +20,7 @@
 #define SEG_N14 0x13
 #define SEG_N15 0x33
 #define SEG_N16 0x7F //FOR DISPLAYING NEGATIVE SIGN -
-uint8_t SEG_BUF[17]={SEG_N0, SEG_N1, SEG_N2, SEG_N3, SEG_N4, SEG_N5,
+const uint8_t SEG_BUF[17]={SEG_N0, SEG_N1, SEG_N2, SEG_N3, SEG_N4, SEG_N5,
 SEG_N6, SEG_N7, SEG_N8, SEG_N9, SEG_N10, SEG_N11, SEG_N12, SEG_N13,
 SEG_N14, SEG_N15, SEG_N16};
 void OpenSevenSegment(void)
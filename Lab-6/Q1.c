@@ -36,6 +36,7 @@
 #include "LCD.h"                // LCD顯示器控制函數
 #include "Scankey.h"            // 按鍵掃描函數
 #include "clk.h"                // 時鐘控制函數
+#include "LCD_Text.h"           // LCD文字行快取（只重畫改變的字元）
 
 // ================================================================
 // 按鍵定義
@@ -213,7 +214,7 @@ void update_display(void)
         i++;
     }
     line_buffer[16] = '\0';
-    print_Line(0, line_buffer);   // 在第 0 行顯示
+    LCD_textLine(0, line_buffer);   // 在第 0 行顯示（只重畫改變的字元）
 
     // 顯示 3 行數字（視窗最多顯示 3 個）
     for (j = 0; j < 3; j++)
@@ -237,7 +238,7 @@ void update_display(void)
             i++;
         }
         line_buffer[16] = '\0';
-        print_Line(j + 1, line_buffer);   // 顯示在第 1~3 行
+        LCD_textLine(j + 1, line_buffer);   // 顯示在第 1~3 行
     }
 }
 
@@ -250,6 +251,7 @@ int main(void)
     SYS_Init();
     init_LCD();
     clear_LCD();
+    LCD_textInit();
     OpenKeyPad();
     init_leds();
     init_buzzer();
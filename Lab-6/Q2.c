@@ -7,6 +7,7 @@
 #include "LCD.h"
 #include "Scankey.h"
 #include "Seven_Segment.h"
+#include "LCD_Shadow.h"
 
 // --- Screen Dimensions ---
 #define SCREEN_WIDTH 128
@@ -19,8 +20,9 @@
 #define BMP_PAGES (BMP_HEIGHT / 8) // 4 pages
 #define BMP_SIZE (BMP_WIDTH * BMP_PAGES) // 32 * 4 = 128 bytes
 
-// --- Buffer for the entire LCD screen ---
-unsigned char screen_buffer[SCREEN_WIDTH * SCREEN_PAGES]; // 128 * 8 = 1024 bytes
+// --- Image styles: the black (highlighted) version is the inverted white one ---
+#define IMG_WHITE LCD_BLIT_COPY
+#define IMG_BLACK LCD_BLIT_INVERT
 
 // Global variables for traffic light system
 int traffic_state = 0; // 0=initial, 1-5=sequence states
@@ -31,10 +33,9 @@ int timer_counter = 0; // 1-second timer counter
 static int blink_state = 0; // Static variable for blinking state
 
 // BMP image arrays - forward declarations (32x32 pixels = 32*4 bytes)
-unsigned char go_white[32*4];
-unsigned char go_black[32*4];
-unsigned char stop_white[32*4];
-unsigned char stop_black[32*4];
+// const: the images stay in flash instead of being copied to SRAM at reset
+extern const unsigned char go_white[BMP_SIZE];
+extern const unsigned char stop_white[BMP_SIZE];
 
 
 
@@ -49,30 +50,8 @@ void StartTrafficSequence(void);
 void ProcessTrafficTimer(void);
 void SetVehicleLights(int red, int yellow, int green);
 void SetPedestrianLights(int red, int green);
-void print_C(unsigned char* stop_image, unsigned char* go_image);
-void print_C_at_position(unsigned char* image, int start_page, int start_col);
-void copy_bitmap_to_buffer(unsigned char* dest_buffer, const unsigned char* src_bitmap, int dest_x, int dest_y_page, int src_width, int src_height_pages);
-
-void copy_bitmap_to_buffer(unsigned char* dest_buffer, const unsigned char* src_bitmap, int dest_x, int dest_y_page, int src_width, int src_height_pages) {
-    int src_byte_idx = 0;
-    int p, x; /* Declare loop variables for C89 */
-
-    /* Loop through pages of source bitmap */
-    for (p = 0; p < src_height_pages; p++) {
-        int target_page = dest_y_page + p;
-        if (target_page >= SCREEN_PAGES) continue; /* Boundary check */
-
-        /* Loop through columns of source bitmap for this page */
-        for (x = 0; x < src_width; x++) {
-            int target_x = dest_x + x;
-            if (target_x >= SCREEN_WIDTH) continue; /* Boundary check */
-
-            /* Copy byte from source to destination buffer */
-            dest_buffer[target_page * SCREEN_WIDTH + target_x] = src_bitmap[src_byte_idx];
-            src_byte_idx++;
-        }
-    }
-}
+void print_C(uint8_t stop_style, uint8_t go_style);
+void print_C_at_position(const unsigned char* image, int start_page, int start_col);
 
 void Buzz(int number)
 {
@@ -264,10 +243,10 @@ void UpdateLCDDisplay(void)
         // Initial state - display based on blink state
         if(blink_state) {
             // When yellow light is on, show both images dimmed
-            print_C(stop_black, go_black);
+            print_C(IMG_BLACK, IMG_BLACK);
         } else {
             // When lights are off, show STOP highlighted
-            print_C(stop_white, go_black);
+            print_C(IMG_WHITE, IMG_BLACK);
         }
         return;
     }
@@ -275,26 +254,26 @@ void UpdateLCDDisplay(void)
     // Display appropriate images based on current state (for pedestrians)
     switch(traffic_state) {
         case 1: // Vehicle Green - pedestrians must STOP
-            print_C(stop_white, go_black);
+            print_C(IMG_WHITE, IMG_BLACK);
             break;
         case 2: // Vehicle Yellow - pedestrians must STOP
         case 3: // Vehicle Red - pedestrians still must wait
-            print_C(stop_white, go_black);
+            print_C(IMG_WHITE, IMG_BLACK);
             break;
         case 4: // Vehicle Red, Pedestrian Green - pedestrians can GO
-            print_C(stop_black, go_white);
+            print_C(IMG_BLACK, IMG_WHITE);
             break;
         case 5: // Vehicle Red, Pedestrian Red - pedestrians must STOP again
-            print_C(stop_white, go_black);
+            print_C(IMG_WHITE, IMG_BLACK);
             break;
         default:
-            print_C(stop_black, go_black);
+            print_C(IMG_BLACK, IMG_BLACK);
             break;
     }
 }
 
 // BMP image data - 32x32 pixels (4 pages x 32 columns)
-unsigned char go_white[32*4]={
+const unsigned char go_white[BMP_SIZE]={
 0x00,0xFE,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xF2,0x0A,0x3A,0x02,0xEA,0x02,0xF2,0x0A,0x0A,0x0A,0xF2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xFE,0x00,
 0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x20,0xF9,0x05,0x05,0x05,0x05,0x0C,0x78,0x09,0x19,0x11,0xB0,0x60,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,
 0x00,0xFF,0x00,0x00,0xF8,0x04,0x02,0x02,0x1F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x0E,0x2F,0x80,0x7F,0x10,0x10,0xE0,0x00,0x00,0xFF,0x00,
@@ -302,15 +281,8 @@ unsigned char go_white[32*4]={
 };
 
 
-unsigned char go_black[32*4]={
-0xFF,0x01,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x0D,0xF5,0xC5,0xFD,0x15,0xFD,0x0D,0xF5,0xF5,0xF5,0x0D,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0x01,0xFF,
-0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0xDF,0x06,0xFA,0xFA,0xFA,0xFA,0xF3,0x87,0xF6,0xE6,0xEE,0x4F,0x9F,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-0xFF,0x00,0xFF,0xFF,0x07,0xFB,0xFD,0xFD,0xE0,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF7,0xFF,0xF1,0xD0,0x7F,0x80,0xEF,0xEF,0x1F,0xFF,0xFF,0x00,0xFF,
-0xFF,0x80,0xBF,0xBF,0xBC,0xBB,0xBB,0xBB,0xBD,0xBE,0xBD,0xBB,0xBB,0xB7,0xB7,0xB7,0xB7,0xB7,0xB7,0xB7,0xB3,0xAD,0xAE,0xAF,0xAF,0xB7,0xB9,0xBE,0xBF,0xBF,0x80,0xFF
-};
-
 
-unsigned char stop_white[32*4]={
+const unsigned char stop_white[BMP_SIZE]={
 0x00,0xFE,0x02,0x02,0xAA,0x0A,0x2A,0x0A,0x32,0x02,0x7A,0x42,0x52,0x0A,0xF2,0x02,0xF2,0x0A,0x0A,0x0A,0xF2,0x02,0xC2,0x42,0xF2,0x4A,0x4A,0xF2,0x02,0x02,0xFE,0x00,
 0x00,0xFF,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0xC0,0x20,0x10,0x10,0x08,0x09,0x88,0x88,0x09,0x89,0x91,0x10,0x20,0xC1,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0xFF,0x00,
 0x00,0xFF,0x00,0x00,0x00,0x00,0x78,0x86,0x81,0x80,0x40,0x00,0x08,0x08,0x00,0x0E,0x0F,0x20,0x0E,0x0F,0x00,0x88,0x08,0x03,0x84,0x78,0x00,0x00,0x00,0x00,0xFF,0x00,
@@ -318,59 +290,44 @@ unsigned char stop_white[32*4]={
 };
 
 
-unsigned char stop_black[32*4]={
-0xFF,0x01,0xFD,0xFD,0x55,0xF5,0xD5,0xF5,0xCD,0xFD,0x85,0xBD,0xAD,0xF5,0x0D,0xFD,0x0D,0xF5,0xF5,0xF5,0x0D,0xFD,0x3D,0xBD,0x0D,0xB5,0xB5,0x0D,0xFD,0xFD,0x01,0xFF,
-0xFF,0x00,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0x3F,0xDF,0xEF,0xEF,0xF7,0xF6,0x77,0x77,0xF6,0x76,0x6E,0xEF,0xDF,0x3E,0xFF,0xFE,0xFF,0xFF,0xFE,0xFF,0xFF,0x00,0xFF,
-0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x87,0x79,0x7E,0x7F,0xBF,0xFF,0xF7,0xF7,0xFF,0xF1,0xF0,0xDF,0xF1,0xF0,0xFF,0x77,0xF7,0xFC,0x7B,0x87,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-0xFF,0x80,0xBF,0xBF,0xBF,0xBF,0xB3,0xAD,0xAE,0xAF,0xAE,0xAE,0xAD,0xAD,0xAB,0xB7,0xB7,0xA7,0xAB,0xAB,0xAD,0xAD,0xAE,0xAE,0xAD,0xB3,0xBF,0xBF,0xBF,0xBF,0x80,0xFF
-};
-
 
 
 // Display BMP images on LCD - STOP on top, GO on bottom  
-void print_C(unsigned char* stop_image, unsigned char* go_image)
+void print_C(uint8_t stop_style, uint8_t go_style)
 {
-    int i;
     int x_offset;
    
-    clear_LCD();
-   
-    /* Clear the screen buffer */
-    for (i = 0; i < SCREEN_WIDTH * SCREEN_PAGES; i++) {
-        screen_buffer[i] = 0x00; /* Clear to black background */
-    }
+    /* Both images always cover the same area, so the screen is not cleared:
+       an image that did not change (e.g. GO while STOP blinks) sends nothing */
    
     /* Calculate horizontal offset for centering 32-pixel wide images */
     x_offset = (SCREEN_WIDTH - BMP_WIDTH) / 2; /* (128 - 32) / 2 = 48 */
    
-    /* Copy the top bitmap (STOP image) centered, starting at Page 0 */
-    copy_bitmap_to_buffer(screen_buffer, stop_image, x_offset, 0, BMP_WIDTH, BMP_PAGES);
+    /* Draw the top bitmap (STOP image) centered, starting at row 0;
+       IMG_BLACK draws the inverted image, so no separate black copy is stored */
+    LCD_shadowBlit(x_offset, 0, stop_white, BMP_WIDTH, BMP_HEIGHT, stop_style);
    
-    /* Copy the bottom bitmap (GO image) centered, starting at Page 4 */
-    copy_bitmap_to_buffer(screen_buffer, go_image, x_offset, 4, BMP_WIDTH, BMP_PAGES);
+    /* Draw the bottom bitmap (GO image) centered, starting at row 32 */
+    LCD_shadowBlit(x_offset, BMP_HEIGHT, go_white, BMP_WIDTH, BMP_HEIGHT, go_style);
    
-    /* Draw the combined buffer to the LCD */
-    draw_LCD(screen_buffer);
+    /* Send only the changed columns (4*32 data + 12 address bytes per image
+       at most, instead of draw_LCD()'s 1024 bytes each with its own address) */
+    LCD_shadowFlush(NULL);
 }
 
-// LCD BMP display functions are provided by LCD.h
-// Using draw_LCD() function as shown in tutorial materials
+// LCD transfers go through LCD_Shadow.c (lcdSetAddr/lcdWriteData from LCD.h)
 
-// Display single BMP image at specific position
-void print_C_at_position(unsigned char* image, int start_page, int start_col)
+// Display single BMP image at specific position (start_page = 8-pixel page, clipped at the edges)
+void print_C_at_position(const unsigned char* image, int start_page, int start_col)
 {
-    int i;
-   
     /* Clear the screen buffer */
-    for (i = 0; i < SCREEN_WIDTH * SCREEN_PAGES; i++) {
-        screen_buffer[i] = 0x00;
-    }
+    LCD_shadowClear();
    
-    /* Copy the bitmap to specified position */
-    copy_bitmap_to_buffer(screen_buffer, image, start_col, start_page, BMP_WIDTH, BMP_PAGES);
+    /* Draw the bitmap at the specified position */
+    LCD_shadowBlit(start_col, start_page * 8, image, BMP_WIDTH, BMP_HEIGHT, LCD_BLIT_COPY);
    
-    /* Draw to LCD */
-    draw_LCD(screen_buffer);
+    /* Send the changed columns to the LCD */
+    LCD_shadowFlush(NULL);
 }
 
 int main(void)
@@ -392,7 +349,7 @@ int main(void)
     PB11 = 1; // Turn off Buzzer
    
     init_LCD();
-    clear_LCD();
+    LCD_shadowInit(); // clears the LCD and the shadow buffer together
    
     // Initialize 7-segment display
     OpenSevenSegment();
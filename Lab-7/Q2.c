@@ -13,6 +13,7 @@
 #include "LCD.h"
 #include "Draw2D.h"
 #include "Scankey.h"
+#include "LCD_List.h"
 
 // 像素狀態定義
 #define PIXEL_ON 1	// 像素開啟（顯示）
@@ -23,6 +24,10 @@
 #define Y0 60	 // 球體初始Y座標（底部區域，從原本的32改為60）
 #define RADIUS 3 // 球體半徑（像素）
 
+// 每一步的間隔（微秒）：主程式每步只建立顯示列表，球體是一次快取遮罩的點陣圖，
+// 每步約60個SPI3字組（SPI3 1MHz約0.6毫秒）由背景端送出；間隔可以遠小於50毫秒
+#define STEP_US 50000
+
 // 目標方塊相關定義
 #define BLOCK_SIZE 5	// 目標方塊尺寸（5x5像素）
 #define MIN_DISTANCE 20 // 兩個方塊之間的最小水平距離（像素），避免方塊過於接近
@@ -144,6 +149,53 @@ int CheckOverlap(int16_t cx, int16_t cy, int16_t cr, int16_t bx, int16_t by, int
 	return 0; // 未發生碰撞
 }
 
+/**
+ * 繪製目標方塊
+ * @param bx 方塊中心X座標
+ * @param by 方塊中心Y座標
+ * @param color PIXEL_ON=繪製，PIXEL_OFF=清除
+ * 功能：在顯示列表加入BLOCK_SIZE x BLOCK_SIZE的矩形命令
+ * 說明：背景端以page位元組加遮罩繪製，5x5方塊每行最多2個位元組（原本逐點25次draw_Pixel）
+ */
+void draw_Block(int16_t bx, int16_t by, uint8_t color)
+{
+	LCD_listFillRect(bx - BLOCK_SIZE / 2, by - BLOCK_SIZE / 2,
+					 bx + BLOCK_SIZE / 2, by + BLOCK_SIZE / 2, color);
+}
+
+/**
+ * 繪製整個畫面（仍可見的方塊與球體）
+ * @param x 球體圓心X座標
+ * @param y 球體圓心Y座標
+ * @param r 球體半徑
+ * @param b1x 方塊1中心X座標
+ * @param b1y 方塊1中心Y座標
+ * @param b1 方塊1是否可見
+ * @param b2x 方塊2中心X座標
+ * @param b2y 方塊2中心Y座標
+ * @param b2 方塊2是否可見
+ * 功能：把畫面上所有物件放進顯示列表後立即返回，由SPI3中斷在背景繪製與送出
+ * 說明：列表描述整個畫面，球體移走或方塊消失的位置自動變為空白，
+ *       不需要先以背景色擦除；原本每一步都等待 draw_Circle() 逐點送出
+ *       球體由 LCD_listCircle() 取用半徑RADIUS的快取遮罩（第一次使用時建立），
+ *       背景端每個page只做位元組位移，不再重算中點畫圓
+ */
+void draw_Scene(int16_t x, int16_t y, int16_t r,
+				int16_t b1x, int16_t b1y, int b1, int16_t b2x, int16_t b2y, int b2)
+{
+	LCD_listBegin();
+	if (b1)
+	{
+		draw_Block(b1x, b1y, PIXEL_ON);
+	}
+	if (b2)
+	{
+		draw_Block(b2x, b2y, PIXEL_ON);
+	}
+	LCD_listCircle(x, y, r, PIXEL_ON);
+	LCD_listSubmit();
+}
+
 /**
  * 主程式入口
  * 功能：實作彈跳球體與目標方塊碰撞遊戲
@@ -162,9 +214,6 @@ int32_t main(void)
 	int16_t x, y;		  // 球體當前位置座標
 	int16_t new_x, new_y; // 球體下一個位置的座標
 
-	// --- 顯示顏色定義 ---
-	uint16_t fgColor, bgColor; // 前景色和背景色
-
 	// --- 按鍵處理變數 ---
 	uint8_t keyin, last_key; // 當前按鍵值和上一個按鍵值（用於檢測按鍵釋放，避免重複觸發）
 
@@ -182,9 +231,6 @@ int32_t main(void)
 	// --- 碰撞檢測變數 ---
 	int overlap; // 是否發生碰撞（0=未碰撞，1=已碰撞）
 
-	// --- 迴圈計數變數 ---
-	int16_t i, j; // 用於繪製方塊的迴圈計數變數
-
 	// --- 初始化遊戲狀態變數 ---
 	last_key = 0;		// 初始化上一個按鍵值為0（無按鍵）
 	is_moving = 0;		// 初始化為停止狀態（球體不會自動移動）
@@ -195,7 +241,8 @@ int32_t main(void)
 	// --- 系統初始化 ---
 	SYS_Init();	  // 系統初始化（時鐘、GPIO等基本設定）
 	init_LCD();	  // LCD顯示器初始化
-	clear_LCD();  // 清除LCD螢幕內容
+	clear_LCD();	  // 清除LCD螢幕內容
+	LCD_listInit();	  // 顯示列表（畫面由SPI3中斷送出）
 	OpenKeyPad(); // 按鍵掃描功能初始化
 
 	// --- 蜂鳴器初始化 ---
@@ -211,10 +258,6 @@ int32_t main(void)
 	dirX = 0;	// 初始X方向為0（無方向）
 	dirY = 0;	// 初始Y方向為0（無方向）
 
-	// --- 顏色設定 ---
-	bgColor = BG_COLOR; // 設定背景色
-	fgColor = FG_COLOR; // 設定前景色
-
 	// --- 初始化隨機數種子（使用SysTick計數器獲取隨機初始值） ---
 	// SysTick->VAL是系統計數器的當前值，每次啟動時都不同，可作為隨機種子
 	seedCounter = SysTick->VAL;
@@ -222,27 +265,8 @@ int32_t main(void)
 	// --- 在啟動時產生兩個隨機位置的目標方塊 ---
 	GenerateTwoBlocks(&block1_x, &block1_y, &block2_x, &block2_y, &seedCounter);
 
-	// --- 繪製第一個方塊（5x5像素方塊） ---
-	// 從方塊中心向四周繪製BLOCK_SIZE x BLOCK_SIZE的像素區域
-	for (i = block1_x - BLOCK_SIZE / 2; i <= block1_x + BLOCK_SIZE / 2; i++)
-	{
-		for (j = block1_y - BLOCK_SIZE / 2; j <= block1_y + BLOCK_SIZE / 2; j++)
-		{
-			draw_Pixel(i, j, FG_COLOR, bgColor); // 繪製前景色像素（黑色方塊）
-		}
-	}
-
-	// --- 繪製第二個方塊（5x5像素方塊） ---
-	for (i = block2_x - BLOCK_SIZE / 2; i <= block2_x + BLOCK_SIZE / 2; i++)
-	{
-		for (j = block2_y - BLOCK_SIZE / 2; j <= block2_y + BLOCK_SIZE / 2; j++)
-		{
-			draw_Pixel(i, j, FG_COLOR, bgColor); // 繪製前景色像素（黑色方塊）
-		}
-	}
-
-	// --- 繪製初始位置的球體 ---
-	draw_Circle(x, y, r, fgColor, bgColor);
+	// --- 繪製兩個方塊（5x5像素方塊）與初始位置的球體 ---
+	draw_Scene(x, y, r, block1_x, block1_y, block1_visible, block2_x, block2_y, block2_visible);
 
 	// --- 主程式迴圈 ---
 	while (1)
@@ -340,30 +364,8 @@ int32_t main(void)
 					block1_visible = 1; // 標記方塊1為可見
 					block2_visible = 1; // 標記方塊2為可見
 
-					// 清除整個LCD並重新繪製所有物件
-					clear_LCD();
-
-					// 重新繪製第一個方塊
-					for (i = block1_x - BLOCK_SIZE / 2; i <= block1_x + BLOCK_SIZE / 2; i++)
-					{
-						for (j = block1_y - BLOCK_SIZE / 2; j <= block1_y + BLOCK_SIZE / 2; j++)
-						{
-							draw_Pixel(i, j, FG_COLOR, bgColor);
-						}
-					}
-
-					// 重新繪製第二個方塊
-					for (i = block2_x - BLOCK_SIZE / 2; i <= block2_x + BLOCK_SIZE / 2; i++)
-					{
-						for (j = block2_y - BLOCK_SIZE / 2; j <= block2_y + BLOCK_SIZE / 2; j++)
-						{
-							draw_Pixel(i, j, FG_COLOR, bgColor);
-						}
-					}
-
-					// 重新繪製球體（保持當前位置）
-					fgColor = FG_COLOR;
-					draw_Circle(x, y, r, fgColor, bgColor);
+					// 重新繪製兩個方塊與球體（保持當前位置）
+					draw_Scene(x, y, r, block1_x, block1_y, block1_visible, block2_x, block2_y, block2_visible);
 				}
 				break;
 			}
@@ -434,14 +436,7 @@ int32_t main(void)
 			{
 				if (CheckOverlap(x, y, r, block1_x, block1_y, BLOCK_SIZE))
 				{
-					// 當前位置已重疊！立即清除方塊1
-					for (i = block1_x - BLOCK_SIZE / 2; i <= block1_x + BLOCK_SIZE / 2; i++)
-					{
-						for (j = block1_y - BLOCK_SIZE / 2; j <= block1_y + BLOCK_SIZE / 2; j++)
-						{
-							draw_Pixel(i, j, bgColor, bgColor); // 用背景色繪製，清除方塊
-						}
-					}
+					// 當前位置已重疊！立即清除方塊1（下一個畫面不再畫出）
 					block1_visible = 0; // 標記方塊1為已消失
 					overlap = 1;		// 標記為已碰撞
 				}
@@ -451,14 +446,7 @@ int32_t main(void)
 			{
 				if (CheckOverlap(x, y, r, block2_x, block2_y, BLOCK_SIZE))
 				{
-					// 當前位置已重疊！立即清除方塊2
-					for (i = block2_x - BLOCK_SIZE / 2; i <= block2_x + BLOCK_SIZE / 2; i++)
-					{
-						for (j = block2_y - BLOCK_SIZE / 2; j <= block2_y + BLOCK_SIZE / 2; j++)
-						{
-							draw_Pixel(i, j, bgColor, bgColor); // 用背景色繪製，清除方塊
-						}
-					}
+					// 當前位置已重疊！立即清除方塊2（下一個畫面不再畫出）
 					block2_visible = 0; // 標記方塊2為已消失
 					overlap = 1;		// 標記為已碰撞
 				}
@@ -469,14 +457,7 @@ int32_t main(void)
 			{
 				if (CheckOverlap(new_x, new_y, r, block1_x, block1_y, BLOCK_SIZE))
 				{
-					// 將要發生碰撞！清除方塊1
-					for (i = block1_x - BLOCK_SIZE / 2; i <= block1_x + BLOCK_SIZE / 2; i++)
-					{
-						for (j = block1_y - BLOCK_SIZE / 2; j <= block1_y + BLOCK_SIZE / 2; j++)
-						{
-							draw_Pixel(i, j, bgColor, bgColor); // 用背景色繪製，清除方塊
-						}
-					}
+					// 將要發生碰撞！清除方塊1（下一個畫面不再畫出）
 					block1_visible = 0; // 標記方塊1為已消失
 					overlap = 1;		// 標記為已碰撞
 				}
@@ -486,14 +467,7 @@ int32_t main(void)
 			{
 				if (CheckOverlap(new_x, new_y, r, block2_x, block2_y, BLOCK_SIZE))
 				{
-					// 將要發生碰撞！清除方塊2
-					for (i = block2_x - BLOCK_SIZE / 2; i <= block2_x + BLOCK_SIZE / 2; i++)
-					{
-						for (j = block2_y - BLOCK_SIZE / 2; j <= block2_y + BLOCK_SIZE / 2; j++)
-						{
-							draw_Pixel(i, j, bgColor, bgColor); // 用背景色繪製，清除方塊
-						}
-					}
+					// 將要發生碰撞！清除方塊2（下一個畫面不再畫出）
 					block2_visible = 0; // 標記方塊2為已消失
 					overlap = 1;		// 標記為已碰撞
 				}
@@ -505,10 +479,6 @@ int32_t main(void)
 				// 所有方塊都已消失，重置遊戲狀態
 				// 重要：在移動之前先重置，避免球體繼續移動
 
-				// 清除當前位置的球體
-				fgColor = BG_COLOR; // 使用背景色清除
-				draw_Circle(x, y, r, fgColor, bgColor);
-
 				// 重置球體到初始位置
 				x = X0; // 重置X座標到中央
 				y = Y0; // 重置Y座標到底部
@@ -520,9 +490,8 @@ int32_t main(void)
 				dirX = 0;	   // 清除X方向
 				dirY = 0;	   // 清除Y方向
 
-				// 在初始位置重新繪製球體
-				fgColor = FG_COLOR; // 使用前景色繪製
-				draw_Circle(x, y, r, fgColor, bgColor);
+				// 在初始位置重新繪製球體（方塊消失與舊球體自動清除）
+				draw_Scene(x, y, r, block1_x, block1_y, 0, block2_x, block2_y, 0);
 
 				// 如果發生碰撞，觸發蜂鳴器（目前Buzz函數未實作）
 				if (overlap)
@@ -535,42 +504,14 @@ int32_t main(void)
 				continue; // 跳過後續繪製步驟，直接進入下一次迴圈
 			}
 
-			// --- 步驟4：正常移動處理 - 清除舊位置並繪製新位置 ---
+			// --- 步驟4：正常移動處理 - 更新位置並繪製新畫面 ---
 			// 只有在所有檢查完成後才執行移動，確保不會在異常狀態下移動
-			fgColor = BG_COLOR; // 使用背景色清除舊球體
-			draw_Circle(x, y, r, fgColor, bgColor);
-
-			// --- 步驟5：重新繪製仍然可見的方塊（避免球體移動時擦除方塊） ---
-			// 這確保方塊在球體移動後仍然正確顯示
-			if (block1_visible)
-			{
-				for (i = block1_x - BLOCK_SIZE / 2; i <= block1_x + BLOCK_SIZE / 2; i++)
-				{
-					for (j = block1_y - BLOCK_SIZE / 2; j <= block1_y + BLOCK_SIZE / 2; j++)
-					{
-						draw_Pixel(i, j, FG_COLOR, bgColor); // 重新繪製方塊1
-					}
-				}
-			}
-
-			if (block2_visible)
-			{
-				for (i = block2_x - BLOCK_SIZE / 2; i <= block2_x + BLOCK_SIZE / 2; i++)
-				{
-					for (j = block2_y - BLOCK_SIZE / 2; j <= block2_y + BLOCK_SIZE / 2; j++)
-					{
-						draw_Pixel(i, j, FG_COLOR, bgColor); // 重新繪製方塊2
-					}
-				}
-			}
-
-			// 更新球體位置到新位置
 			x = new_x; // 更新X座標
 			y = new_y; // 更新Y座標
 
-			// 在新位置繪製球體
-			fgColor = FG_COLOR; // 使用前景色繪製
-			draw_Circle(x, y, r, fgColor, bgColor);
+			// --- 步驟5：繪製仍然可見的方塊與新位置的球體 ---
+			// 舊球體與消失的方塊不在列表中，背景端重畫這些範圍時自動清除
+			draw_Scene(x, y, r, block1_x, block1_y, block1_visible, block2_x, block2_y, block2_visible);
 
 			// 如果發生反彈或碰撞方塊，觸發蜂鳴器（目前Buzz函數未實作）
 			if (bounced || overlap)
@@ -579,7 +520,7 @@ int32_t main(void)
 			}
 
 			// 動畫延遲（控制移動速度）
-			CLK_SysTickDelay(50000); // 延遲50毫秒，控制球體移動的視覺速度
+			CLK_SysTickDelay(STEP_US); // 控制球體移動的視覺速度
 		}
 		// 當球體停止時
 		else
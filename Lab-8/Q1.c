@@ -5,6 +5,7 @@
 #include "SYS_init.h"
 #include "LCD.h"
 #include "Scankey.h"
+#include "LCD_List.h"
 
 // ==========================================
 //              常數定義
@@ -144,22 +145,27 @@ void LED_OffAll(void)
 // ==========================================
 /**
  * @brief 繪製所有移動物件到LCD
- * @note 清除整個LCD畫面，然後在對應位置顯示4個數字
+ * @note 把4個數字放進顯示列表後立即返回，由SPI3中斷在背景繪製與送出
  * @note 每個數字垂直間距16像素，使用5x7字元顯示
+ * @note 原本先clear_LCD()再printC_5x7()逐點畫出，每個畫面上千個SPI3字組且
+ *       等待全部送完；列表只重送數字移動前後涵蓋的範圍，舊位置自動變為空白
  */
 void draw_all(void)
 {
     int i;
 
-    // 清除整個LCD畫面
-    clear_LCD();
+    // 開始新畫面（列表描述整個畫面，沒有命令的地方是空白）
+    LCD_listBegin();
     
     // 繪製4個移動物件
     for(i = 0; i < 4; i++)
         // 在座標(obj[i].x, i*16)位置顯示數字
         // obj[i].num + '0' 將數字轉換為ASCII字元
         // i*16 確保每個數字垂直間距16像素（0, 16, 32, 48）
-        printC_5x7(obj[i].x, i * 16, obj[i].num + '0');
+        LCD_listChar(obj[i].x, i * 16, obj[i].num + '0');
+
+    // 交給背景送出，不等待SPI3
+    LCD_listSubmit();
 }
 
 /**
@@ -275,6 +281,7 @@ int main(void)
     SYS_Init();         // 系統時鐘和基本設定初始化
     init_LCD();         // LCD顯示器初始化
     clear_LCD();        // 清除LCD畫面
+    LCD_listInit();     // 顯示列表（畫面由SPI3中斷送出）
     OpenKeyPad();       // 按鍵矩陣初始化
     init_LED();         // LED腳位初始化
     init_EINT1();       // 外部中斷1（PB15）初始化
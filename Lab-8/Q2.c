@@ -8,6 +8,10 @@
 #include "Scankey.h"
 // 2D繪圖函數庫，包含矩形繪製等功能
 #include "Draw2D.h"
+// LCD影子畫面緩衝區，只傳送有改變的page/column範圍
+#include "LCD_Shadow.h"
+// 以PDMA在背景送出影子緩衝區，傳送期間繼續計算下一個畫面
+#include "LCD_Dma.h"
 
 // ==========================================
 //              常數定義
@@ -82,6 +86,9 @@ Rect g_paddle;                            // 擋板物件
 Rect g_obstacle;                          // 障礙物物件
 BallObj g_ball;                           // 球體物件
 
+// 上一次畫在LCD上的位置（w=0表示尚未畫過），用於只擦除有移動的物件
+Rect g_drawn_ball, g_drawn_paddle, g_drawn_obstacle;
+
 // ==========================================
 //              函數宣告
 // ==========================================
@@ -89,6 +96,8 @@ void Init_Hardware(void);      // 硬體初始化
 void Init_Game_Data(void);     // 遊戲資料初始化
 void Update_Paddle_Pos(void); // 更新擋板位置（根據ADC）
 void Beep(void);               // 蜂鳴器響聲
+void Erase_Moved(Rect *drawn, int x, int y); // 擦除移動過的物件
+void Draw_Rect(Rect *drawn, int x, int y, int w, int h); // 繪製物件並記錄位置
 void Draw_Game(void);          // 繪製遊戲畫面
 
 // ==========================================
@@ -103,7 +112,8 @@ void Init_Hardware(void)
     // 基本系統初始化
     SYS_Init();      // 系統時鐘和基本設定
     init_LCD();      // LCD顯示器初始化
-    clear_LCD();     // 清除LCD畫面
+    LCD_shadowInit(); // 清除LCD畫面與影子緩衝區
+    LCD_dmaInit(NULL); // 之後的畫面由PDMA送出
     OpenKeyPad();    // 按鍵矩陣初始化
 
     // ========== ADC初始化（可變電阻VR1連接至PA7） ==========
@@ -267,32 +277,60 @@ int Check_Collision(Rect *rect, BallObj *ball)
     return 0;  // 未碰撞
 }
 
+/**
+ * @brief 擦除物件上一次的位置（只在物件移動時）
+ * @param drawn 上一次繪製的位置
+ * @param x 目前X座標
+ * @param y 目前Y座標
+ * @note 擦除只修改影子緩衝區，之後重畫所有物件，重疊部分不會被擦掉
+ */
+void Erase_Moved(Rect *drawn, int x, int y)
+{
+    if (drawn->w == 0 || (drawn->x == x && drawn->y == y)) return;
+
+    LCD_shadowFillRect(drawn->x, drawn->y,
+                       drawn->x + drawn->w - 1, drawn->y + drawn->h - 1, 0);
+}
+
+/**
+ * @brief 繪製物件並記錄位置
+ */
+void Draw_Rect(Rect *drawn, int x, int y, int w, int h)
+{
+    LCD_shadowFillRect(x, y, x + w - 1, y + h - 1, 1);
+    drawn->x = x;
+    drawn->y = y;
+    drawn->w = w;
+    drawn->h = h;
+}
+
 /**
  * @brief 繪製遊戲畫面
- * @note 清除整個LCD，然後繪製球體、擋板和障礙物
- * @note 使用fill_Rectangle函數繪製實心矩形
+ * @note 在影子緩衝區擦除有移動的物件，重畫球體、擋板和障礙物，
+ *       最後只把有改變的page/column範圍交給PDMA送到LCD（立即返回）
+ * @note 原本每100ms以clear_LCD()清除整個畫面，再以fill_Rectangle()
+ *       逐點重畫（每點都要重新設定LCD位址），現在靜止的物件不需傳送
  */
 void Draw_Game(void)
 {
-    // 清除整個LCD畫面
-    clear_LCD();
-    
-    // ========== 1. 繪製球體（8x8像素白色矩形） ==========
-    // fill_Rectangle參數：x0, y0, x1, y1, fgColor, bgColor
-    // fgColor=1（白色），bgColor=0（黑色）
-    fill_Rectangle(g_ball.x, g_ball.y,
-                   g_ball.x + BALL_SIZE - 1, g_ball.y + BALL_SIZE - 1,
-                   1, 0);
-    
-    // ========== 2. 繪製擋板（16x8像素白色矩形） ==========
-    fill_Rectangle(g_paddle.x, g_paddle.y,
-                   g_paddle.x + PADDLE_W - 1, g_paddle.y + PADDLE_H - 1,
-                   1, 0);
-    
-    // ========== 3. 繪製障礙物（16x8像素白色矩形） ==========
-    fill_Rectangle(g_obstacle.x, g_obstacle.y,
-                   g_obstacle.x + OBSTACLE_W - 1, g_obstacle.y + OBSTACLE_H - 1,
-                   1, 0);
+    // ========== 1. 擦除移動過的物件 ==========
+    Erase_Moved(&g_drawn_ball, g_ball.x, g_ball.y);
+    Erase_Moved(&g_drawn_paddle, g_paddle.x, g_paddle.y);
+    Erase_Moved(&g_drawn_obstacle, g_obstacle.x, g_obstacle.y);
+
+    // ========== 2. 繪製球體（8x8像素白色矩形） ==========
+    Draw_Rect(&g_drawn_ball, g_ball.x, g_ball.y, BALL_SIZE, BALL_SIZE);
+
+    // ========== 3. 繪製擋板（16x8像素白色矩形） ==========
+    Draw_Rect(&g_drawn_paddle, g_paddle.x, g_paddle.y, PADDLE_W, PADDLE_H);
+
+    // ========== 4. 繪製障礙物（16x8像素白色矩形） ==========
+    Draw_Rect(&g_drawn_obstacle, g_obstacle.x, g_obstacle.y, OBSTACLE_W, OBSTACLE_H);
+
+    // ========== 5. 送出有改變的範圍 ==========
+    // 上一個畫面還在傳送時會先等它完成；之後PDMA在背景傳送，
+    // 主程式繼續讀取ADC、計算球體位置
+    LCD_dmaFlush(NULL);
 }
 
 // ==========================================
@@ -317,6 +355,10 @@ int main(void)
         {
             // 初始化遊戲資料（球體、擋板、障礙物位置）
             Init_Game_Data();
+
+            // GAME OVER文字直接畫在LCD上，重新清除畫面與影子緩衝區
+            LCD_shadowInit();
+            g_drawn_ball.w = g_drawn_paddle.w = g_drawn_obstacle.w = 0;
             
             // 繪製初始畫面
             Draw_Game();
@@ -388,7 +430,8 @@ int main(void)
         // ========== 狀態3：遊戲結束 ==========
         else if (g_state == STATE_GAMEOVER)
         {
-            // 清除畫面並顯示遊戲結束訊息
+            // 清除畫面並顯示遊戲結束訊息（直接使用SPI3，先等PDMA傳送完成）
+            LCD_dmaWait();
             clear_LCD();
             printS(30, 24, "GAME OVER");  // 在座標(30, 24)顯示"GAME OVER"
             
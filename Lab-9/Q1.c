@@ -5,6 +5,8 @@
 #include "MCU_init.h"
 #include "SYS_init.h"
 #include "LCD.h"
+#include "LCD_Shadow.h"
+#include "Snake_Body.h"     // 蛇身方向格子
 
 // ==========================================
 //              常數定義
@@ -42,9 +44,9 @@ volatile uint8_t u8ADF;        // ADC中斷旗標（未使用）
 volatile uint16_t X_ADC, Y_ADC; // X軸和Y軸ADC值（在中斷中更新）
 volatile uint8_t  B_Button;     // 按鈕狀態（未使用）
 
-// 蛇身座標陣列（index 0 = 尾部，index 15 = 頭部）
-int8_t snake_x[SNAKE_LEN];  // 蛇身X座標（格子座標系統）
-int8_t snake_y[SNAKE_LEN];  // 蛇身Y座標（格子座標系統）
+// 蛇身方向格子（第0節 = 尾部，第15節 = 頭部，格子座標系統）
+// 每一步只加入新的頭、移除尾巴，不搬移整個陣列
+SnakeBody snake;
 
 // 方向控制變數
 Direction current_dir = DIR_RIGHT;  // 當前移動方向
@@ -110,28 +112,20 @@ void Init_ADC(void)
  * @param gy 格子Y座標（0-31）
  * @param color 顏色（1=白色，0=黑色）
  * @note 將格子座標轉換為像素座標（乘以2）
- * @note 每個格子由2x2像素組成，繪製4個像素點
+ * @note 每個格子由2x2像素組成，以影子緩衝區的遮罩寫入繪製（Library/LCD_Shadow.h）
  */
 void draw_Snake_Block(int8_t gx, int8_t gy, uint16_t color)
 {
-    int16_t px;  // 像素X座標
-    int16_t py;  // 像素Y座標
-    uint16_t bg; // 背景顏色
-
     // 格子座標轉換為像素座標（每個格子2x2像素）
-    px = gx * 2;
-    py = gy * 2;
-    
-    // 計算背景顏色
-    // color=1（白色方塊）時，bg=0（黑色背景）
-    // color=0（黑色方塊）時，bg=1（白色背景）
-    bg = (color == 0) ? 1 : 0;
-    
-    // 繪製2x2像素方塊（4個像素點）
-    draw_Pixel(px,     py,     color, bg);  // 左上
-    draw_Pixel(px + 1, py,     color, bg);  // 右上
-    draw_Pixel(px,     py + 1, color, bg);  // 左下
-    draw_Pixel(px + 1, py + 1, color, bg);  // 右下
+    int16_t px = gx * 2;
+    int16_t py = gy * 2;
+
+    // py為偶數，2x2方塊的兩列必在同一個page：每行只寫1個遮罩位元組
+    LCD_shadowFillRect(px, py, px + 1, py + 1, (uint8_t)color);
+
+    // 立即送出（3位址+2資料位元組；原本4次draw_Pixel各需3+1次傳送）
+    // 2x2格子的CPU時間比逐點略多，省下的是SPI3傳送（見Tools/LcdBench）
+    LCD_shadowFlush(NULL);
 }
 
 /**
@@ -156,16 +150,16 @@ void init_Snake(void)
     next_dir = DIR_RIGHT;
 
     // 清除LCD畫面
-    clear_LCD();
+    LCD_shadowInit();
 
     // 繪製初始蛇身（16格，從左到右水平排列）
+    Snake_bodyInit(&snake);
     for(i = 0; i < SNAKE_LEN; i++) {
-        // 設定每個節點的座標（X遞增，Y固定）
-        snake_x[i] = start_x + i;  // X座標：start_x, start_x+1, ..., start_x+15
-        snake_y[i] = start_y;      // Y座標：全部相同（水平排列）
+        // 由尾到頭加入節點（X遞增，Y固定）：start_x, start_x+1, ..., start_x+15
+        Snake_bodyPush(&snake, start_x + i, start_y);
         
         // 繪製白色方塊（color=1）
-        draw_Snake_Block(snake_x[i], snake_y[i], 1);
+        draw_Snake_Block(start_x + i, start_y, 1);
     }
 }
 
@@ -237,9 +231,9 @@ void update_Joystick_Logic(void)
  */
 int32_t main (void)
 {
-    int i;
     int8_t head_x, head_y;  // 當前蛇頭座標
     int8_t new_x, new_y;    // 新蛇頭座標
+    int8_t tail_x, tail_y;  // 移除的尾部座標
     int valid_move;         // 移動有效性旗標
     
     int game_over = 0;      // 遊戲結束旗標
@@ -275,7 +269,7 @@ int32_t main (void)
     // ========== 4. 週邊設備初始化 ==========
     Init_ADC();             // 初始化ADC（搖桿輸入）
     init_LCD();             // 初始化LCD顯示器
-    clear_LCD();            // 清除LCD畫面
+    LCD_shadowInit();       // 清除LCD畫面與影子緩衝區
     
     // PC0設為輸入模式，作為重置按鈕
     GPIO_SetMode(PC, BIT0, GPIO_MODE_INPUT);
@@ -308,9 +302,9 @@ int32_t main (void)
         // 只有當方向不為STOP時才移動
         if (next_dir != DIR_STOP) {
             
-            // 取得當前蛇頭座標（陣列最後一個元素）
-            head_x = snake_x[SNAKE_LEN - 1];
-            head_y = snake_y[SNAKE_LEN - 1];
+            // 取得當前蛇頭座標
+            head_x = SNAKE_BODY_HEAD_X(&snake);
+            head_y = SNAKE_BODY_HEAD_Y(&snake);
             
             // 初始化新座標為當前座標
             new_x = head_x;
@@ -337,41 +331,24 @@ int32_t main (void)
             }
 
             // ========== 自身碰撞檢查 ==========
-            // 檢查新位置是否與蛇身重疊（不包括尾部，因為尾部會被清除）
-            if (valid_move) {
-                for (i = 0; i < SNAKE_LEN - 1; i++) {
-                    // 如果新位置與任何身體節點重疊
-                    if (snake_x[i] == new_x && snake_y[i] == new_y) {
-                        valid_move = 0;  // 碰撞自身，移動無效
-                        game_over = 1;    // 設定遊戲結束旗標
-                        break;
-                    }
-                }
+            // 檢查新位置是否與蛇身重疊（含尾部；佔用表一次位元測試）
+            if (valid_move && Snake_bodyContains(&snake, new_x, new_y)) {
+                valid_move = 0;  // 碰撞自身，移動無效
+                game_over = 1;    // 設定遊戲結束旗標
             }
 
             // ========== 執行移動 ==========
             if (valid_move) {
-                // 清除舊尾部（繪製黑色方塊）
-                draw_Snake_Block(snake_x[0], snake_y[0], 0);
+                // 移除舊尾部並清除（繪製黑色方塊）
+                Snake_bodyPop(&snake, &tail_x, &tail_y);
+                draw_Snake_Block(tail_x, tail_y, 0);
 
-                // 蛇身前移：每個節點移動到前一個節點的位置
-                for (i = 0; i < SNAKE_LEN - 1; i++) {
-                    snake_x[i] = snake_x[i+1];  // X座標前移
-                    snake_y[i] = snake_y[i+1];  // Y座標前移
-                }
-
-                // 新增蛇頭：將新位置設為最後一個元素（蛇頭）
-                snake_x[SNAKE_LEN - 1] = new_x;
-                snake_y[SNAKE_LEN - 1] = new_y;
+                // 新增蛇頭（只寫入舊蛇頭的方向碼，其他節點不動）
+                Snake_bodyPush(&snake, new_x, new_y);
 
                 // 繪製新蛇頭（白色方塊）
+                // 格子以遮罩寫入，清除尾部不影響相鄰格子，不需重繪整條蛇
                 draw_Snake_Block(new_x, new_y, 1);
-
-                // 重繪整條蛇（避免殘影問題）
-                // 這確保所有節點都正確顯示，即使有繪圖延遲
-                for (i = 0; i < SNAKE_LEN; i++) {
-                    draw_Snake_Block(snake_x[i], snake_y[i], 1);
-                }
             }
         }
         
@@ -4,10 +4,15 @@
 #include "MCU_init.h"
 #include "SYS_init.h"
 #include "LCD.h"
-#include "Seven_Segment.h" 
+#include "Segment_Port.h"      // 七段顯示器驅動（DMASK單次寫入）
+#include "BCD_Counter.h"
+#include "Segment_Frame.h"
+#include "Segment_FrameScan.h"
+#include "Snake_Body.h"
+#include "Snake_Render.h"
 
 // ---------------- 定義常數 ----------------
-#define MAX_SNAKE_LEN 100 
+#define MAX_SNAKE_LEN SNAKE_BODY_MAX  // 整個盤面（方向格子固定512位元組，任何長度都放得下）
 #define GRID_W      64    
 #define GRID_H      32    
 
@@ -22,33 +27,27 @@ typedef enum {
     DIR_RIGHT
 } Direction;
 
-// ---------------- 外部函式宣告 ----------------
-// 確保你有 Seven_Segment.c 在 Library 中
-extern void OpenSevenSegment(void);
-extern void ShowSevenSegment(uint8_t no, uint8_t number);
-extern void CloseSevenSegment(void);
-
 // ---------------- 全域變數 ----------------
 volatile uint8_t u8ADF;
 volatile uint16_t X_ADC, Y_ADC; 
 volatile uint8_t  B_Button;
 
-int8_t snake_x[MAX_SNAKE_LEN];
-int8_t snake_y[MAX_SNAKE_LEN];
-uint16_t current_len = 16; 
+// 蛇身方向格子：每一步只加入新的頭、移除尾巴，不搬移陣列
+SnakeBody snake;
 
 int8_t fruit_x = -1;
 int8_t fruit_y = -1;
 
-int score = 0;
+uint16_t score = 0;     // 分數（壓縮BCD，0x0120 = 120分）
 int game_over = 0;
 
 Direction current_dir = DIR_RIGHT; 
 Direction next_dir = DIR_RIGHT;    
 
 // ---------------- [新功能] Timer 掃描相關變數 ----------------
-volatile int8_t g_DisplayBuf[4] = {-1, -1, -1, -1}; 
-volatile uint8_t g_ScanIndex = 0; 
+// 雙緩衝顯示畫面：主程式寫完4位數才發佈，掃描中斷每輪開始時才切換
+SegmentFrame g_Display = SEG_FRAME_INIT(SEG_FRAME_BLANK);
+SegmentFrameScan g_Scan = SEG_FRAME_SCAN_INIT(g_Display);   // 掃描位置與本輪畫面
 
 // ---------------- Timer0 中斷服務程式 (ISR) ----------------
 // 這個函式由硬體自動呼叫，用來解決七段顯示器閃爍問題
@@ -57,17 +56,9 @@ void TMR0_IRQHandler(void)
     // 1. 清除 Timer0 中斷旗標
     TIMER0->TISR = 1; 
 
-    // 2. 關閉所有顯示 (消影)
-    CloseSevenSegment();
-
-    // 3. 顯示目前的位數
-    if (g_DisplayBuf[g_ScanIndex] != -1) {
-        ShowSevenSegment(g_ScanIndex, g_DisplayBuf[g_ScanIndex]);
-    }
-
-    // 4. 準備下一次掃描的位數
-    g_ScanIndex++;
-    if (g_ScanIndex >= 4) g_ScanIndex = 0;
+    // 2. 關閉所有顯示 (消影)、顯示目前的位數（空白位數不顯示），移到下一個位數
+    //    每輪掃描開始時取得最新的完整畫面（Library/Segment_FrameScan.c）
+    Segment_frameScan(&g_Scan);
 }
 
 // ---------------- 初始化 Timer0 ----------------
@@ -93,22 +84,29 @@ void Init_Timer0_For_Scan(void)
 }
 
 // ---------------- 更新顯示緩衝區 ----------------
-void Update_Score_Display(int val)
+// 分數以BCD保存，每個位數直接取4位元，不需除法；前導0顯示為空白
+// 4個位數寫完才發佈，掃描中斷不會顯示寫到一半的分數
+void Update_Score_Display(uint16_t bcd)
 {
+    uint8_t width = BCD_width(bcd);
+    volatile int8_t *d = Segment_frameBegin(&g_Display);
+
     // 個位數
-    g_DisplayBuf[0] = val % 10;
+    d[0] = BCD_DIGIT(bcd, 0);
 
     // 十位數
-    if (val >= 10) g_DisplayBuf[1] = (val / 10) % 10;
-    else g_DisplayBuf[1] = -1;
+    if (width >= 2) d[1] = BCD_DIGIT(bcd, 1);
+    else d[1] = SEG_FRAME_BLANK;
 
     // 百位數
-    if (val >= 100) g_DisplayBuf[2] = (val / 100) % 10;
-    else g_DisplayBuf[2] = -1;
+    if (width >= 3) d[2] = BCD_DIGIT(bcd, 2);
+    else d[2] = SEG_FRAME_BLANK;
 
     // 千位數
-    if (val >= 1000) g_DisplayBuf[3] = (val / 1000) % 10;
-    else g_DisplayBuf[3] = -1;
+    if (width >= 4) d[3] = BCD_DIGIT(bcd, 3);
+    else d[3] = SEG_FRAME_BLANK;
+
+    Segment_frameCommit(&g_Display);
 }
 
 // ---------------- ADC 相關函式 ----------------
@@ -134,41 +132,25 @@ void Init_ADC(void)
 
 // ---------------- 繪圖與遊戲邏輯 ----------------
 
-void draw_Snake_Block(int8_t gx, int8_t gy, uint16_t color)
+// 記錄改變的格子（每個格子2x2像素），每一步結束時由 Snake_renderFlush()
+// 依蛇身佔用表與水果位置送出，畫或擦都由送出時的內容決定
+void draw_Snake_Block(int8_t gx, int8_t gy)
 {
-    int16_t px = gx * 2;
-    int16_t py = gy * 2;
-    uint16_t bg = (color == 0) ? 1 : 0; 
-    
-    draw_Pixel(px,     py,     color, bg);
-    draw_Pixel(px + 1, py,     color, bg);
-    draw_Pixel(px,     py + 1, color, bg);
-    draw_Pixel(px + 1, py + 1, color, bg);
+    Snake_renderCell(gx, gy);
 }
 
 void spawn_Fruit(void)
 {
-    int valid = 0;
-    int i;
-    int8_t rx, ry;
-
     srand(X_ADC + Y_ADC + score);
 
-    while (!valid) {
-        valid = 1;
-        rx = rand() % GRID_W;
-        ry = rand() % GRID_H;
-
-        for (i = 0; i < current_len; i++) {
-            if (snake_x[i] == rx && snake_y[i] == ry) {
-                valid = 0; 
-                break;
-            }
-        }
+    // 直接選出第 rand() % 空格數 個空格：一次除法，不會重選
+    // （原本隨機選格子、是蛇身就重選，蛇越長重選越多次）
+    if (!Snake_bodyRandomFree(&snake, (uint32_t)rand(), &fruit_x, &fruit_y)) {
+        fruit_x = -1;   // 盤面已滿：沒有水果
+        fruit_y = -1;
+        return;
     }
-    fruit_x = rx;
-    fruit_y = ry;
-    draw_Snake_Block(fruit_x, fruit_y, 1);
+    draw_Snake_Block(fruit_x, fruit_y);
 }
 
 void init_Game(void)
@@ -179,19 +161,16 @@ void init_Game(void)
     
     current_dir = DIR_RIGHT;
     next_dir = DIR_RIGHT; 
-    current_len = 16; 
     score = 0;
     game_over = 0;
 
-    clear_LCD();
-    
-    for(i = 0; i < current_len; i++) {
-        snake_x[i] = start_x + i; 
-        snake_y[i] = start_y;
-        draw_Snake_Block(snake_x[i], snake_y[i], 1); 
+    Snake_bodyInit(&snake);
+    for(i = 0; i < 16; i++) {
+        Snake_bodyPush(&snake, start_x + i, start_y);
     }
 
     spawn_Fruit();
+    Snake_renderAll(&snake, fruit_x, fruit_y);  // 整個畫面（取代 clear_LCD() 加逐格繪製）
     Update_Score_Display(score); // 初始分數顯示
 }
 
@@ -224,8 +203,7 @@ void update_Joystick_Logic(void)
 // ---------------- 主程式 ----------------
 int32_t main (void)
 {
-    int i; 
-    int8_t head_x, head_y, new_x, new_y;
+    int8_t head_x, head_y, new_x, new_y, tail_x, tail_y;
     int valid_move;
 
     SYS_Init();
@@ -270,8 +248,8 @@ int32_t main (void)
 
         if (next_dir != DIR_STOP) {
             
-            head_x = snake_x[current_len - 1];
-            head_y = snake_y[current_len - 1];
+            head_x = SNAKE_BODY_HEAD_X(&snake);
+            head_y = SNAKE_BODY_HEAD_Y(&snake);
             new_x = head_x;
             new_y = head_y;
             valid_move = 1;
@@ -291,45 +269,39 @@ int32_t main (void)
                 game_over = 1;
             }
 
-            if (valid_move) {
-                for (i = 0; i < current_len - 1; i++) { 
-                    if (snake_x[i] == new_x && snake_y[i] == new_y) {
-                        valid_move = 0;
-                        game_over = 1; 
-                        break;
-                    }
-                }
+            // 自身碰撞：佔用表一次位元測試（原本逐節比較，蛇越長越慢）
+            if (valid_move && Snake_bodyContains(&snake, new_x, new_y)) {
+                valid_move = 0;
+                game_over = 1; 
             }
 
             if (valid_move) {
                 if (new_x == fruit_x && new_y == fruit_y) {
                     // 吃到水果
-                    score += 10;
+                    score = BCD_add(score, 0x0010); // +10分
                     Update_Score_Display(score); // 更新顯示 Buffer
 
-                    if (current_len < MAX_SNAKE_LEN) current_len++; 
-                    
-                    snake_x[current_len - 1] = new_x;
-                    snake_y[current_len - 1] = new_y;
+                    // 增長：尾巴不動；已達最大長度時與一般移動相同
+                    if (snake.len >= MAX_SNAKE_LEN) {
+                        Snake_bodyPop(&snake, &tail_x, &tail_y);
+                        draw_Snake_Block(tail_x, tail_y);
+                    }
+                    Snake_bodyPush(&snake, new_x, new_y);
                     
-                    draw_Snake_Block(new_x, new_y, 1);
+                    draw_Snake_Block(new_x, new_y);
                     spawn_Fruit();
                 } else {
-                    draw_Snake_Block(snake_x[0], snake_y[0], 0);
-                    for (i = 0; i < current_len - 1; i++) {
-                        snake_x[i] = snake_x[i+1];
-                        snake_y[i] = snake_y[i+1];
-                    }
-                    snake_x[current_len - 1] = new_x;
-                    snake_y[current_len - 1] = new_y;
-                    draw_Snake_Block(new_x, new_y, 1);
+                    // 移除尾巴、加入新的頭（方向格子，不搬移陣列）
+                    Snake_bodyPop(&snake, &tail_x, &tail_y);
+                    draw_Snake_Block(tail_x, tail_y);
+                    Snake_bodyPush(&snake, new_x, new_y);
+                    draw_Snake_Block(new_x, new_y);
                 }
-                
-                // 斷尾修復
-                for (i = 0; i < current_len; i++) {
-                    draw_Snake_Block(snake_x[i], snake_y[i], 1);
-                }
-                draw_Snake_Block(fruit_x, fruit_y, 1);
+
+                // 只送出這一步改變的格子（頭、尾、新水果），同一個page相鄰的
+                // 格子合併成一段；page位元組由佔用表算出，擦掉尾巴不會擦到相鄰
+                // 的蛇身，不需逐節重畫（原本每一步重畫整條蛇與水果）
+                Snake_renderFlush(&snake, fruit_x, fruit_y, NULL);
             }
         }
         
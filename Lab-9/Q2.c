@@ -4,13 +4,15 @@
 #include "MCU_init.h"
 #include "SYS_init.h"
 #include "LCD.h"
-#include "Seven_Segment.h" 
+#include "LCD_Shadow.h"
+#include "Segment_Port.h"   // 七段顯示器驅動（DMASK單次寫入）
+#include "Snake_Body.h"     // 蛇身方向格子
 
 // ==========================================
 //              常數定義
 // ==========================================
 // 貪食蛇遊戲參數
-#define MAX_SNAKE_LEN 100  // 蛇身最大長度（可動態增長）
+#define MAX_SNAKE_LEN 100  // 蛇身最大長度（可動態增長，最多 SNAKE_BODY_MAX 即整個盤面）
 #define GRID_W      64     // 格子寬度（LCD寬度128除以2，每個格子2x2像素）
 #define GRID_H      32     // 格子高度（LCD高度64除以2，每個格子2x2像素）
 
@@ -34,14 +36,6 @@ typedef enum {
     DIR_RIGHT       // 向右
 } Direction;
 
-// ==========================================
-//              外部函數宣告
-// ==========================================
-// 七段顯示器控制函數（來自Seven_Segment.c函數庫）
-extern void OpenSevenSegment(void);                    // 開啟七段顯示器
-extern void ShowSevenSegment(uint8_t no, uint8_t number); // 顯示指定位數的數字
-extern void CloseSevenSegment(void);                   // 關閉所有七段顯示器（消影）
-
 // ==========================================
 //              全域變數
 // ==========================================
@@ -50,10 +44,9 @@ volatile uint8_t u8ADF;        // ADC中斷旗標（未使用）
 volatile uint16_t X_ADC, Y_ADC; // X軸和Y軸ADC值（在中斷中更新）
 volatile uint8_t  B_Button;     // 按鈕狀態（未使用）
 
-// 蛇身座標陣列（動態長度，最大100格）
-int8_t snake_x[MAX_SNAKE_LEN];  // 蛇身X座標（格子座標系統）
-int8_t snake_y[MAX_SNAKE_LEN];  // 蛇身Y座標（格子座標系統）
-uint16_t current_len = 16;      // 當前蛇身長度（初始為16格）
+// 蛇身方向格子（動態長度，最大100格；snake.len 為當前長度，初始16格）
+// 每一步只加入新的頭、移除尾巴，不搬移整個陣列
+SnakeBody snake;
 
 // 水果位置
 int8_t fruit_x = -1;  // 水果X座標（-1表示尚未生成）
@@ -185,24 +178,20 @@ void Init_ADC(void)
  * @param gy 格子Y座標（0-31）
  * @param color 顏色（1=白色，0=黑色）
  * @note 將格子座標轉換為像素座標（乘以2）
- * @note 每個格子由2x2像素組成，繪製4個像素點
+ * @note 每個格子由2x2像素組成，以影子緩衝區的遮罩寫入繪製（Library/LCD_Shadow.h）
  */
 void draw_Snake_Block(int8_t gx, int8_t gy, uint16_t color)
 {
     // 格子座標轉換為像素座標（每個格子2x2像素）
     int16_t px = gx * 2;
     int16_t py = gy * 2;
-    
-    // 計算背景顏色
-    // color=1（白色方塊）時，bg=0（黑色背景）
-    // color=0（黑色方塊）時，bg=1（白色背景）
-    uint16_t bg = (color == 0) ? 1 : 0;
-    
-    // 繪製2x2像素方塊（4個像素點）
-    draw_Pixel(px,     py,     color, bg);  // 左上
-    draw_Pixel(px + 1, py,     color, bg);  // 右上
-    draw_Pixel(px,     py + 1, color, bg);  // 左下
-    draw_Pixel(px + 1, py + 1, color, bg);  // 右下
+
+    // py為偶數，2x2方塊的兩列必在同一個page：每行只寫1個遮罩位元組
+    LCD_shadowFillRect(px, py, px + 1, py + 1, (uint8_t)color);
+
+    // 立即送出（3位址+2資料位元組；原本4次draw_Pixel各需3+1次傳送）
+    // 2x2格子的CPU時間比逐點略多，省下的是SPI3傳送（見Tools/LcdBench）
+    LCD_shadowFlush(NULL);
 }
 
 /**
@@ -212,34 +201,20 @@ void draw_Snake_Block(int8_t gx, int8_t gy, uint16_t color)
  */
 void spawn_Fruit(void)
 {
-    int valid = 0;  // 位置有效性旗標
-    int i;
-    int8_t rx, ry;  // 隨機X和Y座標
-
     // 使用ADC值和分數作為隨機數種子，增加隨機性
     // 這樣即使在同一位置，每次生成的種子也不同
     srand(X_ADC + Y_ADC + score);
 
-    // 持續產生隨機位置，直到找到不與蛇身重疊的位置
-    while (!valid) {
-        valid = 1;  // 預設位置有效
-        
-        // 產生隨機座標（0到GRID_W-1和0到GRID_H-1）
-        rx = rand() % GRID_W;
-        ry = rand() % GRID_H;
-
-        // 檢查隨機位置是否與蛇身重疊
-        for (i = 0; i < current_len; i++) {
-            if (snake_x[i] == rx && snake_y[i] == ry) {
-                valid = 0;  // 位置與蛇身重疊，無效
-                break;
-            }
-        }
+    // 從空格中直接選出第 rand() % 空格數 個（蛇身佔用表 + 每列佔用數），
+    // 只需一次除法、不會重選；原本隨機選格子、與蛇身重疊就重選，
+    // 蛇越長重選越多次
+    if (!Snake_bodyRandomFree(&snake, (uint32_t)rand(), &fruit_x, &fruit_y)) {
+        fruit_x = -1;  // 盤面已滿：沒有水果
+        fruit_y = -1;
+        return;
     }
     
-    // 設定水果位置並繪製
-    fruit_x = rx;
-    fruit_y = ry;
+    // 繪製水果
     draw_Snake_Block(fruit_x, fruit_y, 1);  // 繪製白色方塊表示水果
 }
 
@@ -261,21 +236,20 @@ void init_Game(void)
     // 重置遊戲狀態
     current_dir = DIR_RIGHT;  // 初始方向向右
     next_dir = DIR_RIGHT;     // 下一個方向也向右
-    current_len = 16;         // 重置蛇身長度為16格
     score = 0;                // 重置分數為0
     game_over = 0;            // 清除遊戲結束旗標
 
     // 清除LCD畫面
-    clear_LCD();
+    LCD_shadowInit();
     
     // 繪製初始蛇身（16格，從左到右水平排列）
-    for(i = 0; i < current_len; i++) {
-        // 設定每個節點的座標（X遞增，Y固定）
-        snake_x[i] = start_x + i;  // X座標：start_x, start_x+1, ..., start_x+15
-        snake_y[i] = start_y;      // Y座標：全部相同（水平排列）
+    Snake_bodyInit(&snake);   // 重置蛇身（長度0）
+    for(i = 0; i < 16; i++) {
+        // 由尾到頭加入節點（X遞增，Y固定）：start_x, start_x+1, ..., start_x+15
+        Snake_bodyPush(&snake, start_x + i, start_y);
         
         // 繪製白色方塊（color=1）
-        draw_Snake_Block(snake_x[i], snake_y[i], 1);
+        draw_Snake_Block(start_x + i, start_y, 1);
     }
 
     // 生成第一個水果
@@ -345,9 +319,9 @@ void update_Joystick_Logic(void)
  */
 int32_t main (void)
 {
-    int i;
     int8_t head_x, head_y;  // 當前蛇頭座標
     int8_t new_x, new_y;    // 新蛇頭座標
+    int8_t tail_x, tail_y;  // 移除的尾部座標
     int valid_move;         // 移動有效性旗標
 
     // ========== 1. 系統初始化 ==========
@@ -418,9 +392,9 @@ int32_t main (void)
         // 只有當方向不為STOP時才移動
         if (next_dir != DIR_STOP) {
             
-            // 取得當前蛇頭座標（陣列最後一個元素）
-            head_x = snake_x[current_len - 1];
-            head_y = snake_y[current_len - 1];
+            // 取得當前蛇頭座標
+            head_x = SNAKE_BODY_HEAD_X(&snake);
+            head_y = SNAKE_BODY_HEAD_Y(&snake);
             
             // 初始化新座標為當前座標
             new_x = head_x;
@@ -448,16 +422,10 @@ int32_t main (void)
             }
 
             // ========== 自身碰撞檢查 ==========
-            // 檢查新位置是否與蛇身重疊（不包括尾部，因為尾部會被清除）
-            if (valid_move) {
-                for (i = 0; i < current_len - 1; i++) {
-                    // 如果新位置與任何身體節點重疊
-                    if (snake_x[i] == new_x && snake_y[i] == new_y) {
-                        valid_move = 0;  // 碰撞自身，移動無效
-                        game_over = 1;    // 設定遊戲結束旗標
-                        break;
-                    }
-                }
+            // 檢查新位置是否與蛇身重疊（含尾部；佔用表一次位元測試）
+            if (valid_move && Snake_bodyContains(&snake, new_x, new_y)) {
+                valid_move = 0;  // 碰撞自身，移動無效
+                game_over = 1;    // 設定遊戲結束旗標
             }
 
             // ========== 執行移動 ==========
@@ -467,12 +435,14 @@ int32_t main (void)
                     // ========== 吃到水果 ==========
                     score += 10;  // 分數增加10分
                     
-                    // 蛇身增長（不超過最大長度）
-                    if (current_len < MAX_SNAKE_LEN) current_len++;
+                    // 蛇身增長：尾巴不動；已達最大長度時與正常移動相同（移除尾巴）
+                    if (snake.len >= MAX_SNAKE_LEN) {
+                        Snake_bodyPop(&snake, &tail_x, &tail_y);
+                        draw_Snake_Block(tail_x, tail_y, 0);
+                    }
                     
                     // 將新位置加入蛇身（作為新的頭部）
-                    snake_x[current_len - 1] = new_x;
-                    snake_y[current_len - 1] = new_y;
+                    Snake_bodyPush(&snake, new_x, new_y);
                     
                     // 繪製新頭部
                     draw_Snake_Block(new_x, new_y, 1);
@@ -481,30 +451,17 @@ int32_t main (void)
                     spawn_Fruit();
                 } else {
                     // ========== 正常移動（未吃到水果） ==========
-                    // 清除舊尾部（繪製黑色方塊）
-                    draw_Snake_Block(snake_x[0], snake_y[0], 0);
+                    // 移除舊尾部並清除（繪製黑色方塊）
+                    Snake_bodyPop(&snake, &tail_x, &tail_y);
+                    draw_Snake_Block(tail_x, tail_y, 0);
 
-                    // 蛇身前移：每個節點移動到前一個節點的位置
-                    for (i = 0; i < current_len - 1; i++) {
-                        snake_x[i] = snake_x[i+1];  // X座標前移
-                        snake_y[i] = snake_y[i+1];  // Y座標前移
-                    }
-
-                    // 新增蛇頭：將新位置設為最後一個元素（蛇頭）
-                    snake_x[current_len - 1] = new_x;
-                    snake_y[current_len - 1] = new_y;
+                    // 新增蛇頭（只寫入舊蛇頭的方向碼，其他節點不動）
+                    Snake_bodyPush(&snake, new_x, new_y);
 
                     // 繪製新蛇頭（白色方塊）
                     draw_Snake_Block(new_x, new_y, 1);
                 }
-                
-                // ========== 重繪所有物件 ==========
-                // 重繪整條蛇（避免殘影問題）
-                for (i = 0; i < current_len; i++) {
-                    draw_Snake_Block(snake_x[i], snake_y[i], 1);
-                }
-                // 重繪水果
-                draw_Snake_Block(fruit_x, fruit_y, 1);
+                // 格子以遮罩寫入，清除尾部不影響相鄰的蛇身與水果，不需重繪
             }
         }
         
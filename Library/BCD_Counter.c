@@ -0,0 +1,93 @@
+/*
+ * ================================================================
+ * BCD_Counter.c: 4位數壓縮BCD計數器
+ * 功能：不使用除法的十進位計數與相加
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include "BCD_Counter.h"
+
+/*
+ * ================================================================
+ * BCD遞增函數
+ * 功能：個位數加1，遇到9則歸0並進位到下一位數
+ * 說明：90%的情況個位數不是9，只需一次比較和一次加法
+ * ================================================================
+ */
+uint16_t BCD_increment(uint16_t bcd)
+{
+    uint16_t mask = 0x000F;     // 目前位數的遮罩
+    uint16_t one = 0x0001;      // 目前位數的1
+
+    while (mask != 0) {
+        if ((bcd & mask) != (0x9999u & mask)) {
+            return (uint16_t)(bcd + one);   // 不需進位
+        }
+        bcd &= (uint16_t)~mask;             // 9 → 0，進位到下一位數
+        mask <<= 4;
+        one <<= 4;
+    }
+    return bcd;                             // 9999 → 0000
+}
+
+/*
+ * ================================================================
+ * BCD相加函數
+ * 功能：逐位數相加，位數和超過9時減10並進位到下一位數（最高位數的進位捨去）
+ * ================================================================
+ */
+uint16_t BCD_add(uint16_t a, uint16_t b)
+{
+    uint16_t result = 0;
+    uint8_t carry = 0;
+    uint8_t shift, sum;
+
+    for (shift = 0; shift < 16; shift += 4) {
+        sum = (uint8_t)(((a >> shift) & 0x0F) + ((b >> shift) & 0x0F) + carry);
+        if (sum > 9) {
+            sum = (uint8_t)(sum - 10);
+            carry = 1;
+        } else {
+            carry = 0;
+        }
+        result |= (uint16_t)sum << shift;
+    }
+    return result;
+}
+
+/*
+ * ================================================================
+ * 二進位轉BCD函數（移位加3法 / double dabble）
+ * 功能：每次左移前，將大於等於5的位數加3
+ * ================================================================
+ */
+uint16_t BCD_fromBinary(uint16_t value)
+{
+    uint32_t work = 0;          // 位數暫存
+    uint8_t i, shift;
+
+    if (value > 9999) value = 9999;
+
+    for (i = 0; i < 16; i++) {
+        for (shift = 0; shift < 16; shift += 4) {
+            if (((work >> shift) & 0x0F) >= 5) work += (uint32_t)3 << shift;
+        }
+        work = (work << 1) | ((value >> 15) & 0x01);
+        value <<= 1;
+    }
+    return (uint16_t)work;
+}
+
+/*
+ * ================================================================
+ * 有效位數函數
+ * ================================================================
+ */
+uint8_t BCD_width(uint16_t bcd)
+{
+    if (bcd & 0xF000) return 4;
+    if (bcd & 0x0F00) return 3;
+    if (bcd & 0x00F0) return 2;
+    return 1;
+}
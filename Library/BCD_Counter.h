@@ -0,0 +1,41 @@
+/*
+ * ================================================================
+ * BCD_Counter.h: 4位數壓縮BCD計數器
+ * 功能：以逐位進位的方式遞增/相加，直接提供七段顯示器所需的4個位數
+ * 硬體：NUC100系列（Cortex-M0，無硬體除法器）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 格式：uint16_t，每4位元一個十進位位數
+ *   bit15-12=千位, bit11-8=百位, bit7-4=十位, bit3-0=個位
+ *   例如：1234 → 0x1234
+ *
+ * Cortex-M0 的 / 與 % 會呼叫函式庫除法（數十個週期），
+ * 在Timer中斷中每次都把二進位數拆成位數並不划算；
+ * 改成直接以BCD計數，取位數只需移位與遮罩。
+ * 超過9999時回到0000（與原本 (x/1000)%10 的顯示結果相同）。
+ */
+
+#ifndef __BCD_COUNTER_H__
+#define __BCD_COUNTER_H__
+
+#include <stdint.h>
+
+#define BCD_MAX     0x9999u     // 最大值9999
+
+// 取得第n位數（0=個位 ... 3=千位）
+#define BCD_DIGIT(bcd, n)   ((uint8_t)(((bcd) >> ((n) * 4)) & 0x0Fu))
+
+// 遞增1（9999 → 0000）
+uint16_t BCD_increment(uint16_t bcd);
+
+// 兩個BCD數相加（結果超過9999時捨去進位）
+uint16_t BCD_add(uint16_t a, uint16_t b);
+
+// 二進位轉BCD（0-9999，使用移位加3法，不需除法；只在初始化時使用）
+uint16_t BCD_fromBinary(uint16_t value);
+
+// 有效位數（不含前導0，0回傳1），用於空白前導0的顯示
+uint8_t BCD_width(uint16_t bcd);
+
+#endif
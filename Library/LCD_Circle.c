@@ -0,0 +1,92 @@
+/*
+ * ================================================================
+ * LCD_Circle.c: 圓形遮罩快取
+ * 功能：依半徑建立並保存圓形外框點陣圖
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 只在主程式呼叫（LCD_listCircle() 等），
+ * 中斷只讀取已建立完成的遮罩。
+ */
+
+#include <string.h>
+#include "LCD_Circle.h"
+
+typedef struct {
+    uint8_t r;                  // 半徑
+    uint16_t offset;            // 遮罩在 s_pool 中的位置
+} LcdCircleSlot;
+
+static uint8_t s_pool[LCD_CIRCLE_POOL];
+static uint16_t s_used = 0;                     // s_pool 已使用的位元組數
+static LcdCircleSlot s_slot[LCD_CIRCLE_SLOTS];
+static uint8_t s_slots = 0;                     // 已建立的遮罩數
+
+void LCD_circleReset(void)
+{
+    s_used = 0;
+    s_slots = 0;
+}
+
+// 在遮罩內點亮 (x, y)（以左上角為原點）
+static void set(uint8_t *m, uint8_t size, int16_t x, int16_t y)
+{
+    m[(y >> 3) * size + x] |= (uint8_t)(1 << (y & 0x07));
+}
+
+/*
+ * ================================================================
+ * 建立遮罩
+ * 功能：與 draw_Circle() 相同的中點畫圓法，圓心在 (r, r)
+ * ================================================================
+ */
+static void build(uint8_t *m, int16_t r)
+{
+    uint8_t size = LCD_CIRCLE_SIZE(r);
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t p = 3 - 2 * r;
+
+    memset(m, 0, size * ((size + 7) >> 3));
+    while (x <= y) {
+        set(m, size, r + x, r + y);
+        set(m, size, r - x, r + y);
+        set(m, size, r + x, r - y);
+        set(m, size, r - x, r - y);
+        set(m, size, r + y, r + x);
+        set(m, size, r - y, r + x);
+        set(m, size, r + y, r - x);
+        set(m, size, r - y, r - x);
+        if (p < 0) {
+            p += 4 * x + 6;
+        } else {
+            p += 4 * (x - y) + 10;
+            y--;
+        }
+        x++;
+    }
+}
+
+const uint8_t *LCD_circleMask(int16_t r)
+{
+    uint16_t bytes;
+    uint8_t i, size;
+    uint8_t *m;
+
+    if (r < 0 || r > LCD_CIRCLE_MAX_R) return NULL;
+    for (i = 0; i < s_slots; i++) {
+        if (s_slot[i].r == r) return &s_pool[s_slot[i].offset];
+    }
+
+    size = LCD_CIRCLE_SIZE(r);
+    bytes = (uint16_t)(size * ((size + 7) >> 3));
+    if (s_slots >= LCD_CIRCLE_SLOTS || bytes > LCD_CIRCLE_POOL - s_used) return NULL;
+
+    m = &s_pool[s_used];
+    build(m, r);
+    s_slot[s_slots].r = (uint8_t)r;
+    s_slot[s_slots].offset = s_used;
+    s_slots++;
+    s_used += bytes;
+    return m;
+}
@@ -0,0 +1,56 @@
+/*
+ * ================================================================
+ * LCD_Circle.h: 圓形遮罩快取
+ * 功能：每種半徑的圓形外框第一次使用時以中點畫圓法畫成點陣圖
+ *       （page-column位元組格式，同 LCD_shadowBlit()），之後畫圓或擦除
+ *       都是一次點陣圖繪製，不再逐點計算（LCD_listCircle() 使用）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 半徑 r 的遮罩為 (2r+1) x (2r+1) 的點陣圖，左上角對應 (xc-r, yc-r)，
+ * 點與 draw_Circle() 相同。畫圓用 LCD_BLIT_OR、擦除用 LCD_BLIT_CLEAR，
+ * 只改變圓周上的像素（圓內外的其他圖形不受影響）：
+ *   m = LCD_circleMask(r);
+ *   LCD_shadowBlit(xc - r, yc - r, m, LCD_CIRCLE_SIZE(r), LCD_CIRCLE_SIZE(r), LCD_BLIT_OR);
+ * 本檔不依賴其他模組。
+ *
+ * 只在 LCD_List.c 中較快（背景端每個page只做位元組位移，不重算整個
+ * 中點畫圓）；直接畫到影子緩衝區時要處理整個 (2r+1) 平方範圍，
+ * 比 LCD_shadowCircle() 或 draw_Circle() 逐點更慢，這時不要使用遮罩。
+ *
+ * 遮罩大小 (2r+1) x ((2r+1+7)/8) 位元組：r=3 為7、r=4 為18、r=8 為51。
+ * 遮罩建立後不會釋放或移動，指標可交給 LCD_List.c 在背景繪製；
+ * 快取已滿時回傳NULL，由呼叫者改用逐點畫法。
+ */
+
+#ifndef __LCD_CIRCLE_H__
+#define __LCD_CIRCLE_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 參數設定
+// ================================================================
+#ifndef LCD_CIRCLE_POOL
+#define LCD_CIRCLE_POOL     256     // 遮罩共用的RAM位元組數
+#endif
+
+#ifndef LCD_CIRCLE_SLOTS
+#define LCD_CIRCLE_SLOTS    8       // 最多快取的半徑種類
+#endif
+
+#define LCD_CIRCLE_MAX_R    127     // 遮罩寬高 2r+1 需放得進 uint8_t
+
+// 半徑 r 的遮罩寬度與高度
+#define LCD_CIRCLE_SIZE(r)  ((uint8_t)(2 * (r) + 1))
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 半徑 r 的遮罩（第一次使用時建立）；r 超出範圍或快取已滿時回傳NULL
+const uint8_t *LCD_circleMask(int16_t r);
+
+// 清除快取（之前取得的遮罩指標不可再使用）
+void LCD_circleReset(void);
+
+#endif
@@ -0,0 +1,208 @@
+/*
+ * ================================================================
+ * LCD_Console.c: 硬體捲動文字主控台
+ * 功能：8個page環狀存放文字行，捲動只改變控制器的顯示起始行
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 每行128個column：21個字元格（5行字型 + 1行間隔）與最右邊2個空白column，
+ * 由右往左送出（畫面左右鏡像，column = 129 - x）。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "LCD_Shadow.h"
+#include "LCD_Font5x7.h"
+#include "LCD_Console.h"
+
+// ---------------- 外部函式宣告 ----------------
+// 由LCD.c提供（同 LCD_Shadow.c）
+extern void lcdWriteCommand(unsigned char temp);
+extern void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+extern void lcdWriteData(unsigned char temp);
+
+#define LCD_COLUMN(x)   (LCD_SHADOW_WIDTH + 1 - (x))
+#define CELL_W          (LCD_FONT5X7_W + 1)
+#define NO_PAGE         0xFF
+
+static char s_text[LCD_SHADOW_PAGES][LCD_CONSOLE_COLS];    // 每個RAM page的文字（空白補滿）
+static uint8_t s_top = 0;           // 畫面最上方的RAM page
+static uint8_t s_lines = 0;         // 已使用的行數
+static uint8_t s_smooth = 0;        // 1=平滑捲動
+static uint8_t s_row = 0;           // 目前的顯示起始行
+static uint8_t s_scroll = 0;        // 平滑捲動還要前進的列數
+static uint8_t s_deferred = NO_PAGE;    // 捲完後才寫入的page
+
+// 文字的第 x 個column
+static uint8_t column(const char *t, uint8_t x)
+{
+    uint8_t cell = x / CELL_W, k = x % CELL_W;
+
+    if (cell >= LCD_CONSOLE_COLS || k >= LCD_FONT5X7_W) return 0;
+    return LCD_font5x7Glyph(t[cell])[k];
+}
+
+// 送出第 page 頁第 a..b 個字元格（b為最後一格時含右邊的空白column）
+static uint16_t send_cells(uint8_t page, uint8_t a, uint8_t b)
+{
+    uint8_t lo = a * CELL_W;
+    uint8_t hi = (b == LCD_CONSOLE_COLS - 1) ? LCD_SHADOW_WIDTH - 1 : b * CELL_W + CELL_W - 1;
+    uint8_t x;
+
+    lcdSetAddr(page, LCD_COLUMN(hi));
+    for (x = hi; ; x--) {
+        lcdWriteData(column(s_text[page], x));
+        if (x == lo) break;
+    }
+    return (uint16_t)(LCD_SHADOW_ADDR_BYTES + hi - lo + 1);
+}
+
+static uint16_t send_line(uint8_t page)
+{
+    return send_cells(page, 0, LCD_CONSOLE_COLS - 1);
+}
+
+static uint16_t start_line(uint8_t row)
+{
+    s_row = row & 0x3F;
+    lcdWriteCommand(LCD_SPI_START_LINE(s_row));
+    return 1;
+}
+
+// 複製文字並以空白補滿
+static void set_text(char *dst, const char *text)
+{
+    uint8_t i;
+
+    for (i = 0; i < LCD_CONSOLE_COLS && text[i] != '\0'; i++) dst[i] = text[i];
+    for (; i < LCD_CONSOLE_COLS; i++) dst[i] = ' ';
+}
+
+// 完成進行中的平滑捲動
+static uint16_t finish(void)
+{
+    uint16_t n = 0;
+
+    if (s_scroll) {
+        s_scroll = 0;
+        n += start_line((uint8_t)(s_top * 8));
+    }
+    if (s_deferred != NO_PAGE) {
+        n += send_line(s_deferred);
+        s_deferred = NO_PAGE;
+    }
+    return n;
+}
+
+/*
+ * ================================================================
+ * 初始化函數
+ * ================================================================
+ */
+void LCD_consoleInit(uint8_t smooth)
+{
+    s_smooth = smooth;
+    LCD_consoleClear();
+}
+
+void LCD_consoleClear(void)
+{
+    uint8_t page;
+
+    s_scroll = 0;
+    s_deferred = NO_PAGE;
+    s_top = 0;
+    s_lines = 0;
+    start_line(0);
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        set_text(s_text[page], "");
+        send_line(page);
+    }
+}
+
+/*
+ * ================================================================
+ * 加入一行
+ * 功能：還有空行時寫在下一個page；已滿時覆寫最舊一行並捲動
+ * ================================================================
+ */
+uint16_t LCD_consolePrint(const char *text)
+{
+    uint16_t n = finish();
+    uint8_t page;
+
+    if (s_lines < LCD_CONSOLE_LINES) {
+        page = (uint8_t)((s_top + s_lines) % LCD_SHADOW_PAGES);
+        s_lines++;
+        set_text(s_text[page], text);
+        return n + send_line(page);
+    }
+
+    page = s_top;
+    s_top = (uint8_t)((s_top + 1) % LCD_SHADOW_PAGES);
+
+    if (!s_smooth) {
+        set_text(s_text[page], text);
+        n += send_line(page);
+        return n + start_line((uint8_t)(s_top * 8));
+    }
+
+    // 平滑捲動：最舊一行先清空，捲完後由 LCD_consoleTick() 寫入
+    set_text(s_text[page], "");
+    n += send_line(page);
+    set_text(s_text[page], text);
+    s_deferred = page;
+    s_scroll = 8;
+    return n;
+}
+
+/*
+ * ================================================================
+ * 修改最下方一行
+ * 功能：比較新舊文字，只送出第一個到最後一個不同字元之間的字元格
+ * ================================================================
+ */
+uint16_t LCD_consoleUpdate(const char *text)
+{
+    char line[LCD_CONSOLE_COLS];
+    uint8_t page, a, b;
+
+    if (s_lines == 0) return LCD_consolePrint(text);
+
+    page = (uint8_t)((s_top + s_lines - 1) % LCD_SHADOW_PAGES);
+    set_text(line, text);
+    for (a = 0; a < LCD_CONSOLE_COLS && line[a] == s_text[page][a]; a++);
+    if (a == LCD_CONSOLE_COLS) return 0;
+    for (b = LCD_CONSOLE_COLS - 1; line[b] == s_text[page][b]; b--);
+
+    memcpy(s_text[page], line, LCD_CONSOLE_COLS);
+    if (page == s_deferred) return 0;           // 捲完時整行寫入
+    return send_cells(page, a, b);
+}
+
+/*
+ * ================================================================
+ * 平滑捲動
+ * 功能：每次呼叫起始行前進1列，第8列時寫入等待中的新行
+ * ================================================================
+ */
+uint8_t LCD_consoleTick(void)
+{
+    if (!s_scroll) return 0;
+
+    s_scroll--;
+    start_line((uint8_t)(s_top * 8 - s_scroll));
+    if (s_scroll == 0 && s_deferred != NO_PAGE) {
+        send_line(s_deferred);
+        s_deferred = NO_PAGE;
+    }
+    return s_scroll ? 1 : 0;
+}
+
+void LCD_consoleExit(void)
+{
+    finish();
+    start_line(0);
+}
@@ -0,0 +1,52 @@
+/*
+ * ================================================================
+ * LCD_Console.h: 硬體捲動文字主控台
+ * 功能：8行x21字元（5x7字型）的文字紀錄，新的一行寫入最舊一行的page，
+ *       以控制器的顯示起始行（0x40|line）捲動，不重送其他page
+ * 硬體：NUC100系列 + 128x64 LCD（LCD.c 的 lcdWriteCommand/lcdSetAddr/lcdWriteData）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 控制器把畫面第 r 列顯示為RAM第 (start + r) % 64 列；8個page當作環狀緩衝區，
+ * 畫面最上方是最舊的一行。行滿之後每加一行：
+ * - 直接捲動：新的一行覆寫最舊一行的page（3+128位元組），再送1個起始行命令
+ * - 平滑捲動：先清空最舊一行的page，每次 LCD_consoleTick() 起始行加1（共8次），
+ *   捲完後才寫入新的一行（畫面不會出現上下分開的半行文字）
+ * 以 print_Line() 重寫整個畫面捲動一行需要64個8x16字元（每個512位元組）。
+ *
+ * 使用方式：
+ *   init_LCD(); LCD_consoleInit(smooth);       清除畫面、起始行設為0
+ *   LCD_consolePrint(text);                    在最下方加一行（必要時捲動）
+ *   LCD_consoleUpdate(text);                   修改最下方一行（只送改變的字元）
+ *   LCD_consoleTick();                         平滑捲動時定期呼叫（例如每5ms）
+ *   回到一般繪圖前 LCD_consoleExit(); clear_LCD();（其他函數都假設起始行為0）
+ */
+
+#ifndef __LCD_CONSOLE_H__
+#define __LCD_CONSOLE_H__
+
+#include <stdint.h>
+
+#define LCD_CONSOLE_LINES   8       // 行數（每行一個page）
+#define LCD_CONSOLE_COLS    21      // 每行字元數（每個字元5+1像素寬）
+
+// 初始化：清除8個page並把起始行設為0；smooth=1時使用平滑捲動
+void LCD_consoleInit(uint8_t smooth);
+
+// 清除所有行（不改變捲動方式）
+void LCD_consoleClear(void);
+
+// 在最下方加入一行（超過21個字元的部分忽略），回傳送出的SPI3位元組數；
+// 平滑捲動進行中時先完成上一次捲動
+uint16_t LCD_consolePrint(const char *text);
+
+// 修改最下方一行，只送出改變的字元範圍，回傳送出的SPI3位元組數
+uint16_t LCD_consoleUpdate(const char *text);
+
+// 平滑捲動：起始行前進1列，回傳1表示還在捲動
+uint8_t LCD_consoleTick(void);
+
+// 完成捲動並把起始行設回0（畫面內容會錯位，之後需 clear_LCD()）
+void LCD_consoleExit(void);
+
+#endif
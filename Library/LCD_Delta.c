@@ -0,0 +1,61 @@
+/*
+ * ================================================================
+ * LCD_Delta.c: 差異幀動畫播放器
+ * 功能：keyframe 以 LCD_shadowBlit() 畫出，之後每次換幀只送出
+ *       差異資料中的各段（LCD_shadowXorSpan()）
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <stdio.h>
+#include "LCD_Shadow.h"
+#include "LCD_Delta.h"
+
+void LCD_deltaInit(LcdDeltaPlayer *p, const LcdDeltaAnim *anim, int16_t x, uint8_t page)
+{
+    p->anim = anim;
+    p->x = x;
+    p->page = page;
+    p->shown = LCD_DELTA_NONE;
+}
+
+void LCD_deltaInvalidate(LcdDeltaPlayer *p)
+{
+    p->shown = LCD_DELTA_NONE;
+}
+
+// 套用一個差異資料，回傳SPI3傳送的位元組數
+static uint16_t apply(const LcdDeltaPlayer *p, const uint8_t *d)
+{
+    uint16_t bytes = 0;
+    uint8_t len;
+
+    while (d[0] != LCD_DELTA_END) {
+        len = d[2];
+        bytes += LCD_shadowXorSpan((uint8_t)(p->page + d[0]), p->x + d[1], &d[3], len);
+        d += 3 + len;
+    }
+    return bytes;
+}
+
+uint16_t LCD_deltaShow(LcdDeltaPlayer *p, uint8_t frame)
+{
+    const LcdDeltaAnim *a = p->anim;
+    uint16_t bytes = 0;
+
+    if (frame >= a->frames) return 0;
+
+    if (p->shown == LCD_DELTA_NONE) {
+        LCD_shadowBlit(p->x, (int16_t)(p->page * 8), a->key, a->w, (uint8_t)(a->pages * 8), LCD_BLIT_COPY);
+        bytes = LCD_shadowFlush(NULL);
+        p->shown = 0;
+    }
+
+    while (p->shown != frame) {
+        bytes += apply(p, a->delta[p->shown]);
+        p->shown++;
+        if (p->shown >= a->frames) p->shown = 0;
+    }
+    return bytes;
+}
@@ -0,0 +1,55 @@
+/*
+ * ================================================================
+ * LCD_Delta.h: 差異幀動畫播放器
+ * 功能：動畫只儲存第0幀（keyframe）與相鄰兩幀的XOR差異段，
+ *       換幀時只把改變的column段XOR到影子緩衝區並直接送出
+ * 硬體：NUC100系列 + 128x64 LCD（經 LCD_Shadow.c）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 差異資料格式（delta[i]：第i幀 -> 第i+1幀，最後一個回到第0幀）：
+ *   每一段：page、x、len、len個XOR位元組（page/x 相對於動畫左上角）
+ *   結尾：LCD_DELTA_END
+ * 差異資料由 Tools/LcdDelta 從原始點陣圖產生並在主機上驗證，不要手動修改。
+ *
+ * 使用方式：
+ *   LCD_deltaInit(&player, &anim, 32, 0);
+ *   換幀：LCD_deltaShow(&player, frame);   回傳本次SPI3傳送的位元組數
+ *   動畫區域被其他圖覆蓋後：LCD_deltaInvalidate(&player);（下次重畫keyframe）
+ *
+ * 動畫左上角必須在page邊界（page 0-7），x 可為任意值（超出畫面的部分裁切）。
+ */
+
+#ifndef __LCD_DELTA_H__
+#define __LCD_DELTA_H__
+
+#include <stdint.h>
+
+#define LCD_DELTA_END       0xFF        // 差異資料結尾（page欄位）
+#define LCD_DELTA_NONE      0xFF        // 播放器尚未顯示任何幀
+
+// 動畫資料（全部放在flash）
+typedef struct {
+    uint8_t w;                          // 寬度（像素）
+    uint8_t pages;                      // 高度（page數）
+    uint8_t frames;                     // 幀數
+    const uint8_t *key;                 // 第0幀：pages*w 位元組，格式同 draw_Bmp64x64()
+    const uint8_t * const *delta;       // frames 個差異資料
+} LcdDeltaAnim;
+
+// 播放器狀態
+typedef struct {
+    const LcdDeltaAnim *anim;
+    int16_t x;                          // 左上角x座標
+    uint8_t page;                       // 左上角page
+    uint8_t shown;                      // 畫面上的幀（LCD_DELTA_NONE=需重畫keyframe）
+} LcdDeltaPlayer;
+
+void LCD_deltaInit(LcdDeltaPlayer *p, const LcdDeltaAnim *anim, int16_t x, uint8_t page);
+void LCD_deltaInvalidate(LcdDeltaPlayer *p);
+
+// 顯示第 frame 幀：從畫面上的幀依序套用差異（跳過的幀也會套用），
+// 回傳本次SPI3傳送的位元組數
+uint16_t LCD_deltaShow(LcdDeltaPlayer *p, uint8_t frame);
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * ================================================================
+ * LCD_Dma.c: LCD影子緩衝區的PDMA非同步送出
+ * 功能：dirty區段轉成9位元傳送字組，由PDMA逐字組寫入SPI3，
+ *       完成時以PDMA中斷通知
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * SPI3已由 init_LCD() 設定為9位元主控模式；LCD.c 每個字組都手動拉低/
+ * 拉高SS0，這裡改用自動SS，由硬體在每個字組前後切換。LCD.c 的函數
+ * 會關閉自動SS，因此每次開始傳送前都重新設定。
+ */
+
+#include <stdio.h>
+#include "NUC100Series.h"
+#include "SYS.h"
+#include "LCD_Shadow.h"
+#include "LCD_Dma.h"
+
+// ---------------- 傳送狀態 ----------------
+static uint16_t s_words[LCD_DMA_WORDS];     // 傳送緩衝區（PDMA讀取中不可修改）
+static volatile uint8_t s_busy = 0;         // PDMA傳送中（中斷清除）
+static LcdDmaDone s_done = 0;               // 完成通知
+
+/*
+ * ================================================================
+ * 初始化函數
+ * 功能：PDMA通道固定由 s_words 遞增讀取、寫入SPI3的TX0（位址不變），
+ *       每次傳送只需設定字組數
+ * ================================================================
+ */
+void LCD_dmaInit(LcdDmaDone done)
+{
+    s_done = done;
+    s_busy = 0;
+
+    CLK_EnableModuleClock(PDMA_MODULE);                         // 啟用 PDMA 時鐘
+    PDMA_Open(1 << LCD_DMA_CHANNEL);
+    PDMA_SetTransferMode(LCD_DMA_CHANNEL, PDMA_SPI3_TX, 0, 0);  // 由SPI3 TX請求
+    PDMA_SetTransferAddr(LCD_DMA_CHANNEL, (uint32_t)s_words, PDMA_SAR_INC,
+                         (uint32_t)&SPI3->TX[0], PDMA_DAR_FIX);
+    PDMA_EnableInt(LCD_DMA_CHANNEL, PDMA_IER_BLKD_IE);          // 整批完成中斷
+    NVIC_EnableIRQ(PDMA_IRQn);
+}
+
+/*
+ * ================================================================
+ * 送出函數
+ * ================================================================
+ */
+uint16_t LCD_dmaFlush(LcdShadowStats *stats)
+{
+    uint16_t n;
+
+    LCD_dmaWait();                                  // 傳送緩衝區還在使用中
+
+    n = LCD_shadowStage(s_words, LCD_DMA_WORDS, stats);
+    if (n == 0) return 0;
+
+    SPI_EnableAutoSS(SPI3, SPI_SS0, SPI_SS_ACTIVE_LOW);
+    PDMA_SetTransferCnt(LCD_DMA_CHANNEL, PDMA_WIDTH_16, n);     // 9位元字組以16位元寬度傳送
+    s_busy = 1;
+    PDMA_Trigger(LCD_DMA_CHANNEL);
+    SPI_TRIGGER_TX_PDMA(SPI3);
+    return n;
+}
+
+uint8_t LCD_dmaBusy(void)
+{
+    uint8_t dma = s_busy;
+
+    // PDMA完成時最後一個字組才剛寫入TX0，還要等SPI3移出；
+    // 先讀 s_busy 再讀SPI3狀態，中間完成的傳送不會被漏掉
+    return (SPI_IS_BUSY(SPI3) || dma) ? 1 : 0;
+}
+
+void LCD_dmaWait(void)
+{
+    while (LCD_dmaBusy());
+}
+
+/*
+ * ================================================================
+ * PDMA中斷服務程式
+ * ================================================================
+ */
+void PDMA_IRQHandler(void)
+{
+    if (PDMA_GET_CH_INT_STS(LCD_DMA_CHANNEL) & PDMA_ISR_BLKD_IF) {
+        PDMA_CLR_CH_INT_FLAG(LCD_DMA_CHANNEL, PDMA_ISR_BLKD_IF);
+        s_busy = 0;
+        if (s_done) s_done();
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * ================================================================
+ * LCD_Dma.h: LCD影子緩衝區的PDMA非同步送出
+ * 功能：LCD_dmaFlush() 把dirty區段轉成SPI3傳送字組後交給PDMA，
+ *       立即返回；傳送期間主程式可以計算並畫下一個畫面
+ * 硬體：Nu-LB-NUC140開發板（SPI3接LCD、PDMA通道 LCD_DMA_CHANNEL）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * LCD_shadowFlush() 每個位元組都要等SPI3傳送完成（9位元），CPU在這段
+ * 時間只能等待；改用本檔後CPU只需把區段複製到傳送緩衝區。
+ * 傳送的字組與 LCD_shadowFlush() 經 lcdSetAddr()/lcdWriteData() 送出的
+ * 完全相同（Tools/LcdDma 以暫存器模型驗證）。
+ *
+ * 傳送緩衝區是呼叫當時的快照，返回後可以立即修改影子緩衝區；
+ * 上一次傳送還沒完成時，LCD_dmaFlush() 會先等待它完成。
+ *
+ * 使用方式：
+ *   init_LCD(); LCD_shadowInit(); LCD_dmaInit(NULL);
+ *   每個畫面：LCD_shadowFillRect()/LCD_shadowBlit() ...
+ *             LCD_dmaFlush(NULL);     立即返回
+ *   直接使用SPI3的函數（LCD_shadowFlush、LCD_shadowXorSpan、LCD_deltaShow、
+ *   clear_LCD、printS 等）之前必須先 LCD_dmaWait()
+ *
+ * 本檔定義 PDMA_IRQHandler()，同一個程式的其他PDMA通道需改由這裡分派。
+ */
+
+#ifndef __LCD_DMA_H__
+#define __LCD_DMA_H__
+
+#include <stdint.h>
+#include "LCD_Shadow.h"
+
+// ================================================================
+// 參數設定
+// ================================================================
+#define LCD_DMA_CHANNEL     2       // PDMA通道（0-8）
+
+// 傳送緩衝區字組數（每個字組2位元組SRAM）：預設可放下整個畫面；
+// 設得較小時，一次放不下的page保持dirty，由下一次 LCD_dmaFlush() 送出
+#ifndef LCD_DMA_WORDS
+#define LCD_DMA_WORDS       LCD_SHADOW_MAX_WORDS
+#endif
+
+// 傳送完成通知（在PDMA中斷中呼叫，須短小；此時最後一個字組可能還在SPI3移出，
+// 要直接使用SPI3仍需 LCD_dmaWait()）
+typedef void (*LcdDmaDone)(void);
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 設定PDMA通道與SPI3的PDMA傳送（在 init_LCD() 之後呼叫），done可為NULL
+void LCD_dmaInit(LcdDmaDone done);
+
+// 開始送出所有dirty區段並立即返回，回傳本次傳送的字組數（即SPI3位元組數，
+// 0=沒有改變）；stats可為NULL
+uint16_t LCD_dmaFlush(LcdShadowStats *stats);
+
+// 1=傳送中（PDMA尚未完成或最後一個字組還在SPI3移出）
+uint8_t LCD_dmaBusy(void);
+
+// 等待傳送完成
+void LCD_dmaWait(void);
+
+#endif
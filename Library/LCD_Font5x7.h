@@ -0,0 +1,27 @@
+/*
+ * ================================================================
+ * LCD_Font5x7.h: 5x7 ASCII字型表
+ * 功能：ASCII 0x20-0x7F 每個字元5個位元組（每行一個位元組，bit0在上），
+ *       格式與 printC_5x7() 使用的字型相同，可直接當作5x7點陣圖繪製
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 字型表放在flash（const），供 LCD_List.c 等不經LCD.c繪製文字的模組使用。
+ */
+
+#ifndef __LCD_FONT5X7_H__
+#define __LCD_FONT5X7_H__
+
+#include <stdint.h>
+
+#define LCD_FONT5X7_W       5           // 字元寬度（行數）
+#define LCD_FONT5X7_H       7           // 字元高度（列數）
+#define LCD_FONT5X7_FIRST   0x20        // 第一個字元（空白）
+#define LCD_FONT5X7_CHARS   96          // 0x20-0x7F
+
+extern const uint8_t LCD_font5x7[LCD_FONT5X7_CHARS][LCD_FONT5X7_W];
+
+// 字元的點陣圖（超出範圍的字元以空白顯示，與 printC_5x7() 相同）
+const uint8_t *LCD_font5x7Glyph(char c);
+
+#endif
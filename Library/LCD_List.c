@@ -0,0 +1,501 @@
+/*
+ * ================================================================
+ * LCD_List.c: LCD顯示列表（SPI3中斷在背景繪製與送出）
+ * 功能：繪圖命令依page記錄涵蓋範圍，SPI3每送完一個字組產生中斷，
+ *       中斷送出下一個字組；每個page開始時才把該page畫到一行緩衝區
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 傳送的字組與 LCD_shadowFlush() 相同格式：每個page 3個位址命令，
+ * 資料由範圍右端往左送出（畫面左右鏡像，column = 129 - x）。
+ * SPI3由 init_LCD() 設定為9位元主控模式，這裡使用自動SS，
+ * 只在有畫面送出時開啟SPI3的單次傳送完成中斷。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "LCD_Shadow.h"
+#include "LCD_Font5x7.h"
+#include "LCD_Circle.h"
+#include "LCD_List.h"
+
+#define LCD_COLUMN(x)   (LCD_SHADOW_WIDTH + 1 - (x))
+#define PAGE_EMPTY      0xFF
+
+// 命令種類
+#define CMD_RECT        0
+#define CMD_CIRCLE      1
+#define CMD_BLIT        2
+
+// 矩形運算（mode）
+#define RECT_SET        0
+#define RECT_CLEAR      1
+#define RECT_INVERT     2
+
+// 一個命令：原始參數與裁切後的範圍（16位元組）
+typedef struct {
+    const uint8_t *bmp;         // 點陣圖
+    int16_t x, y;               // 點陣圖左上角 / 圓心
+    uint8_t w, h;               // 點陣圖寬高 / 圓半徑（w）
+    uint8_t op, mode;           // 命令種類、矩形運算或點陣圖模式
+    uint8_t x0, x1, y0, y1;     // 畫面內的範圍（含兩端）
+} LcdListCmd;
+
+typedef struct {
+    LcdListCmd cmd[LCD_LIST_CMDS];
+    uint8_t count;
+    uint8_t lo[LCD_SHADOW_PAGES];       // 每個page被涵蓋的column範圍（PAGE_EMPTY=沒有）
+    uint8_t hi[LCD_SHADOW_PAGES];
+} LcdList;
+
+// 矩形上緣/下緣所在page的遮罩（同 LCD_Shadow.c）
+static const uint8_t s_top[8] = { 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80 };
+static const uint8_t s_bottom[8] = { 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF };
+
+// ---------------- 兩個列表與交接狀態 ----------------
+static LcdList s_list[2];
+static volatile uint8_t s_front = 0;        // 背景端使用中的列表
+static volatile uint8_t s_pending = 0;      // 1=s_list[front^1] 已完成，等待切換
+static volatile uint8_t s_running = 0;      // 1=SPI3中斷送出中
+
+// ---------------- 背景端狀態（只在中斷中使用）----------------
+static uint8_t s_shown_lo[LCD_SHADOW_PAGES];    // 畫面上目前有內容的範圍
+static uint8_t s_shown_hi[LCD_SHADOW_PAGES];
+static uint8_t s_line[LCD_SHADOW_WIDTH];        // 目前page的內容
+static int8_t s_page;                           // 送出中的page
+static uint8_t s_addr;                          // 已送出的位址命令數
+static uint8_t s_x, s_left, s_col;              // 下一個資料的x、剩餘資料數、起始column
+
+// ---------------- 統計 ----------------
+static volatile uint32_t s_submitted, s_latched, s_same, s_words;
+static uint32_t s_overflow;
+
+/*
+ * ================================================================
+ * 初始化函數
+ * ================================================================
+ */
+void LCD_listInit(void)
+{
+    uint8_t page;
+
+    SPI_DisableInt(SPI3, SPI_UNIT_INT_MASK);
+    memset(s_list, 0, sizeof(s_list));
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        s_list[0].lo[page] = s_list[1].lo[page] = PAGE_EMPTY;
+        s_shown_lo[page] = PAGE_EMPTY;
+    }
+    s_front = 0;
+    s_pending = 0;
+    s_running = 0;
+    s_page = LCD_SHADOW_PAGES;
+    s_addr = LCD_SHADOW_ADDR_BYTES;
+    s_left = 0;
+    s_submitted = s_latched = s_same = s_words = 0;
+    s_overflow = 0;
+    NVIC_EnableIRQ(SPI3_IRQn);
+}
+
+/*
+ * ================================================================
+ * 建立畫面（主程式）
+ * ================================================================
+ */
+void LCD_listBegin(void)
+{
+    LcdList *l;
+    uint8_t page;
+
+    s_pending = 0;                      // 之後背景端不會切換 front
+    l = &s_list[s_front ^ 1];
+    l->count = 0;
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) l->lo[page] = PAGE_EMPTY;
+}
+
+// 加入命令：裁切範圍並合併到每個page的範圍；完全在畫面外時回傳NULL
+static LcdListCmd *add(uint8_t op, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    LcdList *l = &s_list[s_front ^ 1];
+    LcdListCmd *c;
+    uint8_t page;
+
+    if (x1 < 0 || x0 >= LCD_SHADOW_WIDTH || y1 < 0 || y0 >= LCD_SHADOW_HEIGHT) return NULL;
+    if (l->count >= LCD_LIST_CMDS) {
+        s_overflow++;
+        return NULL;
+    }
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= LCD_SHADOW_WIDTH) x1 = LCD_SHADOW_WIDTH - 1;
+    if (y1 >= LCD_SHADOW_HEIGHT) y1 = LCD_SHADOW_HEIGHT - 1;
+
+    c = &l->cmd[l->count++];
+    memset(c, 0, sizeof(*c));           // 列表以memcmp比較，未使用的欄位也要固定
+    c->op = op;
+    c->x0 = (uint8_t)x0;
+    c->x1 = (uint8_t)x1;
+    c->y0 = (uint8_t)y0;
+    c->y1 = (uint8_t)y1;
+
+    for (page = c->y0 >> 3; page <= c->y1 >> 3; page++) {
+        if (l->lo[page] == PAGE_EMPTY) {
+            l->lo[page] = c->x0;
+            l->hi[page] = c->x1;
+        } else {
+            if (c->x0 < l->lo[page]) l->lo[page] = c->x0;
+            if (c->x1 > l->hi[page]) l->hi[page] = c->x1;
+        }
+    }
+    return c;
+}
+
+static void rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode)
+{
+    LcdListCmd *c;
+    int16_t t;
+
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { t = y0; y0 = y1; y1 = t; }
+    c = add(CMD_RECT, x0, y0, x1, y1);
+    if (c) c->mode = mode;
+}
+
+void LCD_listFillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+{
+    rect(x0, y0, x1, y1, color ? RECT_SET : RECT_CLEAR);
+}
+
+void LCD_listInvertRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    rect(x0, y0, x1, y1, RECT_INVERT);
+}
+
+void LCD_listCircle(int16_t xc, int16_t yc, int16_t r, uint8_t color)
+{
+    const uint8_t *m = LCD_circleMask(r);
+    LcdListCmd *c;
+
+    // 一般情況：快取的遮罩當作點陣圖，背景端每個page只是位元組位移與合併
+    if (m) {
+        LCD_listBlit(xc - r, yc - r, m, LCD_CIRCLE_SIZE(r), LCD_CIRCLE_SIZE(r),
+                     color ? LCD_BLIT_OR : LCD_BLIT_CLEAR);
+        return;
+    }
+
+    // 快取已滿：背景端逐點計算
+    if (r < 0 || r > 255) return;
+    c = add(CMD_CIRCLE, xc - r, yc - r, xc + r, yc + r);
+    if (!c) return;
+    c->x = xc;
+    c->y = yc;
+    c->w = (uint8_t)r;
+    c->mode = color;
+}
+
+void LCD_listBlit(int16_t x, int16_t y, const uint8_t *bmp, uint8_t w, uint8_t h, uint8_t mode)
+{
+    LcdListCmd *c;
+
+    if (w == 0 || h == 0) return;
+    c = add(CMD_BLIT, x, y, x + w - 1, y + h - 1);
+    if (!c) return;
+    c->bmp = bmp;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->mode = mode;
+}
+
+void LCD_listChar(int16_t x, int16_t y, char c)
+{
+    LCD_listBlit(x, y, LCD_font5x7Glyph(c), LCD_FONT5X7_W, LCD_FONT5X7_H, LCD_BLIT_COPY);
+}
+
+/*
+ * ================================================================
+ * 背景端：繪製一個page（中斷中執行）
+ * 功能：範圍 lo..hi 清為空白後依序套用涵蓋這個page的命令
+ * ================================================================
+ */
+static void render_rect(const LcdListCmd *c, uint8_t page, uint8_t lo, uint8_t hi)
+{
+    uint8_t mask = 0xFF, x;
+
+    if (page == c->y0 >> 3) mask &= s_top[c->y0 & 0x07];
+    if (page == c->y1 >> 3) mask &= s_bottom[c->y1 & 0x07];
+
+    for (x = lo; x <= hi; x++) {
+        if (c->mode == RECT_INVERT) s_line[x] ^= mask;
+        else if (c->mode == RECT_CLEAR) s_line[x] &= (uint8_t)~mask;
+        else s_line[x] |= mask;
+    }
+}
+
+static void plot(int16_t x, int16_t y, uint8_t page, uint8_t lo, uint8_t hi, uint8_t color)
+{
+    uint8_t bit;
+
+    if (x < lo || x > hi || y < 0 || (y >> 3) != page) return;
+    bit = (uint8_t)(1 << (y & 0x07));
+    if (color) s_line[x] |= bit;
+    else s_line[x] &= (uint8_t)~bit;
+}
+
+// 與 LCD_shadowCircle() 相同的中點畫圓法，只保留落在這個page的點
+static void render_circle(const LcdListCmd *c, uint8_t page, uint8_t lo, uint8_t hi)
+{
+    int16_t xc = c->x, yc = c->y;
+    int16_t x = 0, y = c->w;
+    int16_t p = 3 - 2 * c->w;
+
+    while (x <= y) {
+        plot(xc + x, yc + y, page, lo, hi, c->mode);
+        plot(xc - x, yc + y, page, lo, hi, c->mode);
+        plot(xc + x, yc - y, page, lo, hi, c->mode);
+        plot(xc - x, yc - y, page, lo, hi, c->mode);
+        plot(xc + y, yc + x, page, lo, hi, c->mode);
+        plot(xc - y, yc + x, page, lo, hi, c->mode);
+        plot(xc + y, yc - x, page, lo, hi, c->mode);
+        plot(xc - y, yc - x, page, lo, hi, c->mode);
+        if (p < 0) {
+            p += 4 * x + 6;
+        } else {
+            p += 4 * (x - y) + 10;
+            y--;
+        }
+        x++;
+    }
+}
+
+// 同 LCD_Shadow.c 的 blend()
+static uint8_t blend(uint8_t old, uint8_t src, uint8_t mask, uint8_t mode)
+{
+    switch (mode) {
+    case LCD_BLIT_OR:       return old | (src & mask);
+    case LCD_BLIT_AND:      return old & (src | (uint8_t)~mask);
+    case LCD_BLIT_XOR:      return old ^ (src & mask);
+    case LCD_BLIT_INVERT:   return (old & (uint8_t)~mask) | ((uint8_t)~src & mask);
+    case LCD_BLIT_CLEAR:    return old & (uint8_t)~(src & mask);
+    default:                return (old & (uint8_t)~mask) | (src & mask);
+    }
+}
+
+// 點陣圖：這個page由來源第 sp 頁（左移shift）與第 sp-1 頁（右移8-shift）組成
+static void render_blit(const LcdListCmd *c, uint8_t page, uint8_t lo, uint8_t hi)
+{
+    uint8_t pages = (uint8_t)((c->h + 7) >> 3);
+    uint8_t shift = (uint8_t)(c->y & 0x07);
+    uint8_t last_mask = s_bottom[(c->h - 1) & 0x07];
+    int16_t sp = page - (c->y - shift) / 8;
+    const uint8_t *hi_src = NULL, *lo_src = NULL;
+    uint8_t hi_mask = 0, lo_mask = 0, x, v, m;
+
+    if (sp >= 0 && sp < pages) {
+        hi_src = c->bmp + sp * c->w;
+        hi_mask = (uint8_t)(((sp == pages - 1) ? last_mask : 0xFF) << shift);
+    }
+    if (shift && sp >= 1 && sp - 1 < pages) {
+        lo_src = c->bmp + (sp - 1) * c->w;
+        lo_mask = (uint8_t)(((sp - 1 == pages - 1) ? last_mask : 0xFF) >> (8 - shift));
+    }
+
+    for (x = lo; x <= hi; x++) {
+        v = 0;
+        m = 0;
+        if (hi_src) {
+            v |= (uint8_t)(hi_src[x - c->x] << shift);
+            m |= hi_mask;
+        }
+        if (lo_src) {
+            v |= (uint8_t)(lo_src[x - c->x] >> (8 - shift));
+            m |= lo_mask;
+        }
+        if (m) s_line[x] = blend(s_line[x], v, m, c->mode);
+    }
+}
+
+static void render_page(const LcdList *l, uint8_t page, uint8_t lo, uint8_t hi)
+{
+    const LcdListCmd *c;
+    uint8_t i, a, b;
+
+    memset(&s_line[lo], 0, hi - lo + 1);
+    for (i = 0; i < l->count; i++) {
+        c = &l->cmd[i];
+        if (page < (c->y0 >> 3) || page > (c->y1 >> 3) || c->x1 < lo || c->x0 > hi) continue;
+        a = (c->x0 > lo) ? c->x0 : lo;
+        b = (c->x1 < hi) ? c->x1 : hi;
+        switch (c->op) {
+        case CMD_RECT:      render_rect(c, page, a, b); break;
+        case CMD_CIRCLE:    render_circle(c, page, a, b); break;
+        default:            render_blit(c, page, a, b); break;
+        }
+    }
+}
+
+/*
+ * ================================================================
+ * 背景端：產生傳送字組
+ * ================================================================
+ */
+// 開始一個page：範圍為畫面上原有內容與新列表的聯集，沒有內容時回傳0
+static uint8_t begin_page(uint8_t page)
+{
+    const LcdList *l = &s_list[s_front];
+    uint8_t lo = l->lo[page], hi = l->hi[page];
+
+    if (s_shown_lo[page] != PAGE_EMPTY) {
+        if (lo == PAGE_EMPTY) {
+            lo = s_shown_lo[page];
+            hi = s_shown_hi[page];
+        } else {
+            if (s_shown_lo[page] < lo) lo = s_shown_lo[page];
+            if (s_shown_hi[page] > hi) hi = s_shown_hi[page];
+        }
+    }
+    s_shown_lo[page] = l->lo[page];
+    s_shown_hi[page] = l->hi[page];
+    if (lo == PAGE_EMPTY) return 0;
+
+    render_page(l, page, lo, hi);
+    s_addr = 0;
+    s_x = hi;
+    s_left = (uint8_t)(hi - lo + 1);
+    s_col = LCD_COLUMN(hi);
+    return 1;
+}
+
+// 目前畫面的下一個字組，畫面送完時回傳0
+static uint8_t frame_word(uint16_t *w)
+{
+    for (;;) {
+        if (s_addr < LCD_SHADOW_ADDR_BYTES) {
+            switch (s_addr++) {
+            case 0:  *w = LCD_SPI_PAGE(s_page); break;
+            case 1:  *w = LCD_SPI_COL_HI(s_col); break;
+            default: *w = LCD_SPI_COL_LO(s_col); break;
+            }
+            return 1;
+        }
+        if (s_left) {
+            *w = LCD_SPI_DATA(s_line[s_x]);
+            s_x--;
+            s_left--;
+            return 1;
+        }
+        if (s_page + 1 >= LCD_SHADOW_PAGES) {
+            s_page = LCD_SHADOW_PAGES;
+            return 0;
+        }
+        s_page++;
+        begin_page((uint8_t)s_page);
+    }
+}
+
+// 切換到已完成的列表；與畫面上的列表相同時不需送出
+static uint8_t latch(void)
+{
+    const LcdList *next;
+    const LcdList *cur;
+
+    if (!s_pending) return 0;
+    cur = &s_list[s_front];
+    next = &s_list[s_front ^ 1];
+    s_front ^= 1;
+    s_pending = 0;
+    s_latched++;
+
+    if (next->count == cur->count &&
+        memcmp(next->cmd, cur->cmd, next->count * sizeof(LcdListCmd)) == 0) {
+        s_same++;
+        return 0;
+    }
+    s_page = -1;
+    s_left = 0;
+    return 1;
+}
+
+static uint8_t next_word(uint16_t *w)
+{
+    if (frame_word(w)) return 1;
+    return latch() && frame_word(w);
+}
+
+static void send(uint16_t w)
+{
+    s_words++;
+    SPI_WRITE_TX0(SPI3, w);
+    SPI_TRIGGER(SPI3);
+}
+
+/*
+ * ================================================================
+ * 送出函數（主程式）
+ * ================================================================
+ */
+uint8_t LCD_listSubmit(void)
+{
+    uint16_t w;
+    uint8_t n = s_list[s_front ^ 1].count;
+
+    __DMB();                            // 列表內容寫完才發佈
+    s_submitted++;
+    s_pending = 1;
+
+    // 背景端閒置：由這裡送出第一個字組，之後由中斷接手；
+    // 背景端送出中時，它在目前畫面結束時會看到 pending
+    if (!s_running && next_word(&w)) {
+        s_running = 1;
+        SPI_EnableAutoSS(SPI3, SPI_SS0, SPI_SS_ACTIVE_LOW);
+        SPI_EnableInt(SPI3, SPI_UNIT_INT_MASK);
+        send(w);
+    }
+    return n;
+}
+
+uint8_t LCD_listBusy(void)
+{
+    uint8_t busy = s_running || s_pending;
+
+    // 最後一個字組的中斷已清除 s_running；SPI3狀態只是多一層保險（同 LCD_dmaBusy()）
+    return (SPI_IS_BUSY(SPI3) || busy) ? 1 : 0;
+}
+
+void LCD_listWait(void)
+{
+    while (LCD_listBusy());
+}
+
+void LCD_listStats(LcdListStats *stats)
+{
+    stats->submitted = s_submitted;
+    stats->same = s_same;
+    stats->shown = s_latched - s_same;
+    stats->dropped = s_submitted - s_latched - s_pending;
+    stats->words = s_words;
+    stats->overflow = s_overflow;
+}
+
+/*
+ * ================================================================
+ * SPI3中斷服務程式
+ * 功能：一個字組傳送完成，送出下一個；全部送完時關閉中斷
+ * ================================================================
+ */
+void SPI3_IRQHandler(void)
+{
+    uint16_t w;
+
+    SPI_CLR_UNIT_TRANS_INT_FLAG(SPI3);
+    if (!s_running) return;
+
+    if (next_word(&w)) {
+        send(w);
+    } else {
+        SPI_DisableInt(SPI3, SPI_UNIT_INT_MASK);
+        s_running = 0;
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * ================================================================
+ * LCD_List.h: LCD顯示列表（SPI3中斷在背景繪製與送出）
+ * 功能：遊戲程式只把繪圖命令放進固定大小的列表後立即返回，
+ *       SPI3中斷逐page把命令畫到一行緩衝區並逐字組送出
+ * 硬體：Nu-LB-NUC140開發板（SPI3接LCD）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 每個畫面的列表描述整個畫面：命令依序畫在空白背景上，沒有命令的地方
+ * 是空白。列表記錄每個page被命令涵蓋的column範圍，背景端每個page只
+ * 重畫並送出「上一個畫面 + 這個畫面」的範圍，因此移走的物件不需另外擦除；
+ * 與畫面上相同的列表不送出。
+ *
+ * 與 LCD_Shadow.c 的差別：不需要1024位元組的畫面緩衝區（只用一個page的
+ * 128位元組），繪圖與傳送都在中斷中進行，主程式完全不等待SPI3；
+ * 代價是每個有改變的page都重畫整個範圍。
+ *
+ * 使用方式：
+ *   init_LCD(); clear_LCD(); LCD_listInit();
+ *   每個畫面：LCD_listBegin();
+ *             LCD_listFillRect()/LCD_listCircle()/LCD_listChar()/LCD_listBlit() ...
+ *             LCD_listSubmit();       立即返回
+ *   上一個畫面還在送出時，新畫面等它送完才開始；尚未開始送出就又有新畫面時，
+ *   舊的畫面被取代（不顯示）
+ *   直接使用SPI3的函數（clear_LCD、printS、LCD_shadowFlush 等）之前必須先
+ *   LCD_listWait()，之後再回到列表需 clear_LCD(); LCD_listInit();
+ *
+ * 同步方式（與 Segment_Frame.c 相同，不需關閉中斷）：
+ * - 背景端只讀取 s_list[front]，front 只在背景端且 pending=1 時切換
+ * - LCD_listBegin() 先把 pending 清為0，才寫入 s_list[front^1]
+ *
+ * 本檔定義 SPI3_IRQHandler()，使用期間SPI3只能由本檔送出。
+ */
+
+#ifndef __LCD_LIST_H__
+#define __LCD_LIST_H__
+
+#include <stdint.h>
+#include "LCD_Shadow.h"
+
+// ================================================================
+// 參數設定
+// ================================================================
+// 每個畫面最多的命令數（每個命令16位元組，共兩個列表）
+#ifndef LCD_LIST_CMDS
+#define LCD_LIST_CMDS       24
+#endif
+
+// 統計（累計值）；建立畫面的時間可在 LCD_listBegin() 到 LCD_listSubmit()
+// 之間以SysTick量測，與傳送分開
+typedef struct {
+    uint32_t submitted;     // LCD_listSubmit() 次數
+    uint32_t shown;         // 實際送出的畫面數
+    uint32_t same;          // 與畫面上相同而不需送出的畫面數
+    uint32_t dropped;       // 還沒開始送出就被新畫面取代的畫面數
+    uint32_t words;         // SPI3傳送字組數
+    uint32_t overflow;      // 列表已滿而捨棄的命令數
+} LcdListStats;
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 初始化（LCD必須是空白畫面：在 clear_LCD() 或 LCD_shadowInit() 之後呼叫）
+void LCD_listInit(void);
+
+// 開始建立新畫面（清空列表）
+void LCD_listBegin(void);
+
+// 繪圖命令（只記錄命令；超出畫面的部分裁切，完全在畫面外的命令不記錄）
+// 矩形含兩端點、座標順序不拘；color 1=點亮、0=清除
+void LCD_listFillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+void LCD_listInvertRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+// 圓形外框（與 draw_Circle()、LCD_shadowCircle() 相同的點）：記錄為 LCD_Circle.h
+// 快取遮罩的點陣圖命令，color 0 以 LCD_BLIT_CLEAR 清除圓周
+void LCD_listCircle(int16_t xc, int16_t yc, int16_t r, uint8_t color);
+
+// 點陣圖：格式與模式同 LCD_shadowBlit()；只記錄指標，點陣圖在送出完成前
+// 不可修改（放在flash的 const 陣列即可）
+void LCD_listBlit(int16_t x, int16_t y, const uint8_t *bmp, uint8_t w, uint8_t h, uint8_t mode);
+
+// 5x7字元（LCD_Font5x7，覆蓋5x7範圍，同 printC_5x7()）
+void LCD_listChar(int16_t x, int16_t y, char c);
+
+// 完成畫面並交給背景端送出，回傳命令數
+uint8_t LCD_listSubmit(void);
+
+// 1=還有畫面在送出或等待送出
+uint8_t LCD_listBusy(void);
+
+// 等待所有畫面送出完成
+void LCD_listWait(void);
+
+// 讀取統計
+void LCD_listStats(LcdListStats *stats);
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * ================================================================
+ * LCD_Rle.c: 點陣圖RLE串流解碼
+ * 功能：逐位元組解碼，依 draw_Bmp64x64() 的順序（page由上而下、
+ *       每頁由左而右）寫入影子緩衝區
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <stdio.h>
+#include "LCD_Shadow.h"
+#include "LCD_Rle.h"
+
+void LCD_rleBegin(LcdRleReader *r, const uint8_t *src)
+{
+    r->src = src;
+    r->count = 0;
+    r->repeat = 0;
+}
+
+uint8_t LCD_rleNext(LcdRleReader *r)
+{
+    uint8_t c, v;
+
+    if (r->count == 0) {
+        c = *r->src++;
+        r->repeat = (c & LCD_RLE_REPEAT) ? 1 : 0;
+        r->count = r->repeat ? (uint8_t)((c & 0x7F) + LCD_RLE_MIN_REPEAT) : (uint8_t)(c + 1);
+    }
+    r->count--;
+
+    if (!r->repeat) return *r->src++;
+
+    // 重複段：最後一次才移到下一個控制位元組
+    v = *r->src;
+    if (r->count == 0) r->src++;
+    return v;
+}
+
+void LCD_rleDraw(int16_t x, uint8_t page, const uint8_t *rle, uint8_t w, uint8_t pages)
+{
+    LcdRleReader r;
+    uint8_t p, c, v;
+    int16_t col;
+
+    LCD_rleBegin(&r, rle);
+    for (p = 0; p < pages; p++) {
+        for (c = 0; c < w; c++) {
+            v = LCD_rleNext(&r);            // 畫面外的位元組也要讀過
+            col = x + c;
+            if (col >= 0 && col < LCD_SHADOW_WIDTH) LCD_shadowWrite((uint8_t)(page + p), (uint8_t)col, v);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * ================================================================
+ * LCD_Rle.h: 點陣圖RLE串流解碼
+ * 功能：Tools/Bmp2Lcd 以 -r 產生的壓縮點陣圖，一次解出一個位元組
+ *       直接寫入影子緩衝區，不需要完整大小的RAM暫存區
+ * 硬體：NUC100系列 + 128x64 LCD（經 LCD_Shadow.c）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 壓縮格式（解壓後為 pages*w 位元組，格式同 draw_Bmp64x64()）：
+ *   控制位元組 c < 0x80：後面 c+1 個位元組照抄（1-128）
+ *   控制位元組 c >= 0x80：後面1個位元組重複 (c & 0x7F)+3 次（3-130）
+ *   沒有結尾標記，解碼端依 w、pages 決定長度；段可以跨越page
+ *
+ * 使用方式：
+ *   LCD_rleDraw(32, 0, red_rle, 64, 8); LCD_shadowFlush(NULL);
+ *   或自行逐位元組讀取：LCD_rleBegin(&r, data); b = LCD_rleNext(&r); ...
+ */
+
+#ifndef __LCD_RLE_H__
+#define __LCD_RLE_H__
+
+#include <stdint.h>
+
+#define LCD_RLE_REPEAT      0x80        // 控制位元組：重複段
+#define LCD_RLE_MIN_REPEAT  3           // 重複段最短長度
+#define LCD_RLE_MAX_REPEAT  (0x7F + LCD_RLE_MIN_REPEAT)
+#define LCD_RLE_MAX_LITERAL 0x80
+
+// 串流解碼狀態
+typedef struct {
+    const uint8_t *src;                 // 下一個讀取位置
+    uint8_t count;                      // 目前這一段剩餘的位元組數
+    uint8_t repeat;                     // 1=重複段，0=照抄段
+} LcdRleReader;
+
+void LCD_rleBegin(LcdRleReader *r, const uint8_t *src);
+uint8_t LCD_rleNext(LcdRleReader *r);
+
+// 解碼到影子緩衝區：左上角在第 page 頁、x 行（超出畫面的部分裁切），
+// 寬 w、共 pages 頁；只修改緩衝區，之後由 LCD_shadowFlush() 送出
+void LCD_rleDraw(int16_t x, uint8_t page, const uint8_t *rle, uint8_t w, uint8_t pages);
+
+#endif
@@ -0,0 +1,368 @@
+/*
+ * ================================================================
+ * LCD_Shadow.c: LCD影子畫面緩衝區（dirty區段追蹤）
+ * 功能：繪圖寫入RAM緩衝區，flush時只傳送改變的page/column範圍
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 取代 clear_LCD() 後整個重畫、或每次以 draw_LCD() 送出1024位元組的作法。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "LCD.h"
+#include "LCD_Shadow.h"
+
+// ---------------- 外部函式宣告 ----------------
+// 由LCD.c提供：設定位址（page、column）與寫入一個資料位元組，
+// 寫入後控制器的column位址自動加1
+extern void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+extern void lcdWriteData(unsigned char temp);
+
+// 畫面左右鏡像：x 對應控制器column (129 - x)，與 draw_LCD() 相同
+// 因此自動加1的方向是 x 遞減，區段由右往左送出
+#define LCD_COLUMN(x)   (LCD_SHADOW_WIDTH + 1 - (x))
+
+// ---------------- 緩衝區與dirty範圍 ----------------
+static uint8_t s_buf[LCD_SHADOW_PAGES * LCD_SHADOW_WIDTH];
+static uint8_t s_lo[LCD_SHADOW_PAGES];      // dirty範圍左端（PAGE_CLEAN 表示沒有改變）
+static uint8_t s_hi[LCD_SHADOW_PAGES];      // dirty範圍右端
+
+#define PAGE_CLEAN      0xFF
+
+// 矩形運算：新值 = (舊值 & keep) ^ flip，每個page只算一次遮罩
+#define RECT_SET        0
+#define RECT_CLEAR      1
+#define RECT_INVERT     2
+
+// 矩形上緣/下緣所在page的遮罩：s_top[n] = bit n..7，s_bottom[n] = bit 0..n
+static const uint8_t s_top[8] = { 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80 };
+static const uint8_t s_bottom[8] = { 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF };
+
+static void mark(uint8_t page, uint8_t x)
+{
+    if (s_lo[page] == PAGE_CLEAN) {
+        s_lo[page] = x;
+        s_hi[page] = x;
+    } else if (x < s_lo[page]) {
+        s_lo[page] = x;
+    } else if (x > s_hi[page]) {
+        s_hi[page] = x;
+    }
+}
+
+// 寫入一個位元組，值改變時才標記dirty
+static void put(uint8_t page, uint8_t x, uint8_t value)
+{
+    uint8_t *p = &s_buf[(page << 7) + x];
+
+    if (*p != value) {
+        *p = value;
+        mark(page, x);
+    }
+}
+
+/*
+ * ================================================================
+ * 初始化與重送
+ * ================================================================
+ */
+void LCD_shadowInit(void)
+{
+    memset(s_buf, 0, sizeof(s_buf));
+    LCD_shadowInvalidate();
+    LCD_shadowFlush(NULL);
+}
+
+void LCD_shadowInvalidate(void)
+{
+    uint8_t page;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        s_lo[page] = 0;
+        s_hi[page] = LCD_SHADOW_WIDTH - 1;
+    }
+}
+
+/*
+ * ================================================================
+ * 繪圖函數
+ * ================================================================
+ */
+void LCD_shadowClear(void)
+{
+    uint8_t page, x;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        for (x = 0; x < LCD_SHADOW_WIDTH; x++) put(page, x, 0x00);
+    }
+}
+
+void LCD_shadowWrite(uint8_t page, uint8_t x, uint8_t value)
+{
+    if (page >= LCD_SHADOW_PAGES || x >= LCD_SHADOW_WIDTH) return;
+    put(page, x, value);
+}
+
+uint8_t LCD_shadowRead(uint8_t page, uint8_t x)
+{
+    if (page >= LCD_SHADOW_PAGES || x >= LCD_SHADOW_WIDTH) return 0;
+    return s_buf[(page << 7) + x];
+}
+
+void LCD_shadowPixel(int16_t x, int16_t y, uint8_t color)
+{
+    uint8_t page, bit, old;
+
+    if (x < 0 || x >= LCD_SHADOW_WIDTH || y < 0 || y >= LCD_SHADOW_HEIGHT) return;
+
+    page = (uint8_t)(y >> 3);
+    bit = (uint8_t)(1 << (y & 0x07));
+    old = s_buf[(page << 7) + x];
+    put(page, (uint8_t)x, color ? (old | bit) : (old & ~bit));
+}
+
+/*
+ * ================================================================
+ * 矩形函數
+ * 功能：以整個page位元組處理，只有最上與最下的page需要遮罩；
+ *       5x5方塊最多跨2個page，每行最多2次位元組寫入（逐點為25次）
+ * ================================================================
+ */
+static void rect_op(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t op)
+{
+    int16_t t;
+    uint8_t page, first_page, last_page, x, mask, keep, flip, v, lo, hi;
+    uint8_t *row;
+
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { t = y0; y0 = y1; y1 = t; }
+    if (x1 < 0 || x0 >= LCD_SHADOW_WIDTH || y1 < 0 || y0 >= LCD_SHADOW_HEIGHT) return;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= LCD_SHADOW_WIDTH) x1 = LCD_SHADOW_WIDTH - 1;
+    if (y1 >= LCD_SHADOW_HEIGHT) y1 = LCD_SHADOW_HEIGHT - 1;
+
+    first_page = (uint8_t)(y0 >> 3);
+    last_page = (uint8_t)(y1 >> 3);
+
+    for (page = first_page; page <= last_page; page++) {
+        mask = 0xFF;
+        if (page == first_page) mask &= s_top[y0 & 0x07];
+        if (page == last_page) mask &= s_bottom[y1 & 0x07];
+
+        keep = (op == RECT_INVERT) ? 0xFF : (uint8_t)~mask;
+        flip = (op == RECT_CLEAR) ? 0x00 : mask;
+
+        // 只記錄本頁第一個與最後一個改變的位元組，最後標記一次
+        lo = PAGE_CLEAN;
+        hi = 0;
+        row = &s_buf[page << 7];
+        for (x = (uint8_t)x0; x <= (uint8_t)x1; x++) {
+            v = (row[x] & keep) ^ flip;
+            if (v != row[x]) {
+                row[x] = v;
+                if (lo == PAGE_CLEAN) lo = x;
+                hi = x;
+            }
+        }
+        if (lo != PAGE_CLEAN) {
+            mark(page, lo);
+            mark(page, hi);
+        }
+    }
+}
+
+void LCD_shadowFillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+{
+    rect_op(x0, y0, x1, y1, color ? RECT_SET : RECT_CLEAR);
+}
+
+void LCD_shadowClearRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    rect_op(x0, y0, x1, y1, RECT_CLEAR);
+}
+
+void LCD_shadowInvertRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    rect_op(x0, y0, x1, y1, RECT_INVERT);
+}
+
+/*
+ * ================================================================
+ * 圓形函數
+ * 功能：與 Draw2D 的 draw_Circle() 相同的中點畫圓法（外框），
+ *       畫在影子緩衝區，與其他圖形共用同一份畫面
+ * ================================================================
+ */
+void LCD_shadowCircle(int16_t xc, int16_t yc, int16_t r, uint8_t color)
+{
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t p = 3 - 2 * r;
+
+    while (x <= y) {
+        LCD_shadowPixel(xc + x, yc + y, color);
+        LCD_shadowPixel(xc - x, yc + y, color);
+        LCD_shadowPixel(xc + x, yc - y, color);
+        LCD_shadowPixel(xc - x, yc - y, color);
+        LCD_shadowPixel(xc + y, yc + x, color);
+        LCD_shadowPixel(xc - y, yc + x, color);
+        LCD_shadowPixel(xc + y, yc - x, color);
+        LCD_shadowPixel(xc - y, yc - x, color);
+        if (p < 0) {
+            p += 4 * x + 6;
+        } else {
+            p += 4 * (x - y) + 10;
+            y--;
+        }
+        x++;
+    }
+}
+
+/*
+ * ================================================================
+ * 點陣圖函數
+ * 功能：來源的每個位元組依 y%8 位移後分成上下兩個目標page，
+ *       遮罩標出實際屬於點陣圖的位元（最後一頁可能不滿8列）
+ * ================================================================
+ */
+static uint8_t blend(uint8_t old, uint8_t src, uint8_t mask, uint8_t mode)
+{
+    switch (mode) {
+    case LCD_BLIT_OR:       return old | (src & mask);
+    case LCD_BLIT_AND:      return old & (src | (uint8_t)~mask);
+    case LCD_BLIT_XOR:      return old ^ (src & mask);
+    case LCD_BLIT_INVERT:   return (old & (uint8_t)~mask) | ((uint8_t)~src & mask);
+    case LCD_BLIT_CLEAR:    return old & (uint8_t)~(src & mask);
+    default:                return (old & (uint8_t)~mask) | (src & mask);
+    }
+}
+
+void LCD_shadowBlit(int16_t x, int16_t y, const uint8_t *bmp, uint8_t w, uint8_t h, uint8_t mode)
+{
+    uint8_t pages, shift, sp, mask, b, col, sparse;
+    int16_t page, c, c_first, c_end;
+    const uint8_t *src;
+
+    if (w == 0 || h == 0) return;
+
+    // OR/XOR/CLEAR 的0位元組不改變畫面（圓形遮罩等稀疏點陣圖大多是0）
+    sparse = (mode == LCD_BLIT_OR || mode == LCD_BLIT_XOR || mode == LCD_BLIT_CLEAR);
+
+    // 水平裁切：只處理落在畫面內的來源行
+    c_first = (x < 0) ? -x : 0;
+    c_end = (x + w > LCD_SHADOW_WIDTH) ? LCD_SHADOW_WIDTH - x : w;
+    if (c_first >= c_end) return;
+
+    pages = (uint8_t)((h + 7) >> 3);
+    shift = (uint8_t)(y & 0x07);
+    page = (y - shift) / 8;                     // 向下取整（y為負值時也正確）
+
+    for (sp = 0; sp < pages; sp++, page++) {
+        if (page + 1 < 0) continue;             // 上下兩個page都在畫面上方
+        if (page >= LCD_SHADOW_PAGES) break;
+
+        mask = (sp == pages - 1) ? s_bottom[(h - 1) & 0x07] : 0xFF;
+        src = bmp + sp * w;
+
+        for (c = c_first; c < c_end; c++) {
+            b = src[c];
+            if (!b && sparse) continue;
+            col = (uint8_t)(x + c);
+            if (page >= 0) {
+                put((uint8_t)page, col, blend(s_buf[(page << 7) + col],
+                    (uint8_t)(b << shift), (uint8_t)(mask << shift), mode));
+            }
+            if (shift && page + 1 < LCD_SHADOW_PAGES) {
+                put((uint8_t)(page + 1), col, blend(s_buf[((page + 1) << 7) + col],
+                    (uint8_t)(b >> (8 - shift)), (uint8_t)(mask >> (8 - shift)), mode));
+            }
+        }
+    }
+}
+
+/*
+ * ================================================================
+ * 送出函數
+ * 功能：每個dirty的page設定一次位址，再連續寫入範圍內的位元組
+ * ================================================================
+ */
+uint16_t LCD_shadowFlush(LcdShadowStats *stats)
+{
+    LcdShadowStats s = { 0, 0, 0 };
+    uint8_t page, x;
+    const uint8_t *row;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        if (s_lo[page] == PAGE_CLEAN) continue;
+
+        row = &s_buf[page << 7];
+        lcdSetAddr(page, LCD_COLUMN(s_hi[page]));
+        for (x = s_hi[page]; ; x--) {
+            lcdWriteData(row[x]);
+            if (x == s_lo[page]) break;
+        }
+
+        s.data += s_hi[page] - s_lo[page] + 1;
+        s.cmd += LCD_SHADOW_ADDR_BYTES;
+        s.spans++;
+        s_lo[page] = PAGE_CLEAN;
+    }
+
+    if (stats) *stats = s;
+    return s.data + s.cmd;
+}
+
+uint16_t LCD_shadowStage(uint16_t *words, uint16_t max, LcdShadowStats *stats)
+{
+    LcdShadowStats s = { 0, 0, 0 };
+    uint16_t n = 0, len;
+    uint8_t page, x, col;
+    const uint8_t *row;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        if (s_lo[page] == PAGE_CLEAN) continue;
+        len = s_hi[page] - s_lo[page] + 1;
+        if (n + LCD_SHADOW_ADDR_BYTES + len > max) continue;
+
+        row = &s_buf[page << 7];
+        col = LCD_COLUMN(s_hi[page]);
+        words[n++] = LCD_SPI_PAGE(page);
+        words[n++] = LCD_SPI_COL_HI(col);
+        words[n++] = LCD_SPI_COL_LO(col);
+        for (x = s_hi[page]; ; x--) {
+            words[n++] = LCD_SPI_DATA(row[x]);
+            if (x == s_lo[page]) break;
+        }
+        s.data += len;
+        s.cmd += LCD_SHADOW_ADDR_BYTES;
+        s.spans++;
+        s_lo[page] = PAGE_CLEAN;
+    }
+
+    if (stats) *stats = s;
+    return n;
+}
+
+// 直接寫入：緩衝區同時更新，若這段也在dirty範圍內，之後flush會再送一次相同的值
+uint16_t LCD_shadowXorSpan(uint8_t page, int16_t x, const uint8_t *d, uint8_t len)
+{
+    int16_t lo, hi, c;
+    uint8_t *row;
+
+    if (page >= LCD_SHADOW_PAGES || len == 0) return 0;
+    lo = (x < 0) ? 0 : x;
+    hi = (x + len > LCD_SHADOW_WIDTH) ? LCD_SHADOW_WIDTH - 1 : x + len - 1;
+    if (lo > hi) return 0;
+
+    row = &s_buf[page << 7];
+    for (c = lo; c <= hi; c++) row[c] ^= d[c - x];
+
+    lcdSetAddr(page, LCD_COLUMN(hi));
+    for (c = hi; c >= lo; c--) lcdWriteData(row[c]);
+
+    return (uint16_t)(hi - lo + 1 + LCD_SHADOW_ADDR_BYTES);
+}
@@ -0,0 +1,101 @@
+/*
+ * ================================================================
+ * LCD_Shadow.h: LCD影子畫面緩衝區（dirty區段追蹤）
+ * 功能：在RAM中保存128x64畫面，繪圖只修改緩衝區並記錄每個page
+ *       內被改變的column範圍，LCD_shadowFlush() 只把這些範圍經SPI3送出
+ * 硬體：NUC100系列 + 128x64 LCD（LCD.c 的 lcdSetAddr/lcdWriteData）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 緩衝區格式與 draw_LCD() 相同：第 page 頁第 x 行的位元組位於
+ * [page*128 + x]，bit0 為該頁最上方的像素。
+ *
+ * 傳輸成本（SPI3傳送次數）：
+ * - draw_LCD()：每個位元組都重新設定位址，1024 x (3+1) = 4096 次
+ * - draw_Pixel()：每個像素 3+1 次
+ * - LCD_shadowFlush()：每個有改變的page 3次位址命令 + 改變範圍內的位元組數
+ *
+ * 使用方式：
+ *   init_LCD(); LCD_shadowInit();
+ *   每個畫面：LCD_shadowPixel()/LCD_shadowFillRect()/LCD_shadowBlit() ...
+ *             n = LCD_shadowFlush(&stats);
+ *   其他程式直接畫到LCD（printS、clear_LCD 等）之後，影子緩衝區已與畫面
+ *   不一致，需呼叫 LCD_shadowInit()（清除）或 LCD_shadowInvalidate()（重送）
+ *
+ * 只有值真的改變時才會標記dirty，因此重畫相同內容不需傳送。
+ */
+
+#ifndef __LCD_SHADOW_H__
+#define __LCD_SHADOW_H__
+
+#include <stdint.h>
+
+#define LCD_SHADOW_WIDTH        128
+#define LCD_SHADOW_HEIGHT       64
+#define LCD_SHADOW_PAGES        (LCD_SHADOW_HEIGHT / 8)
+#define LCD_SHADOW_ADDR_BYTES   3       // lcdSetAddr()：page、column高4位、column低4位
+
+// SPI3的9位元傳送字組（與 LCD.c 相同）：bit8=0為命令、1為資料
+#define LCD_SPI_PAGE(p)         (0xB0u | (p))
+#define LCD_SPI_COL_HI(c)       (0x10u | (((c) >> 4) & 0x0Fu))
+#define LCD_SPI_COL_LO(c)       ((c) & 0x0Fu)
+#define LCD_SPI_DATA(b)         (0x100u | (b))
+#define LCD_SPI_START_LINE(l)   (0x40u | ((l) & 0x3Fu))    // 顯示起始行（畫面最上方顯示的RAM列）
+
+// 整個畫面dirty時的傳送字組數（每個page 3個位址命令 + 128個資料）
+#define LCD_SHADOW_MAX_WORDS    (LCD_SHADOW_PAGES * (LCD_SHADOW_ADDR_BYTES + LCD_SHADOW_WIDTH))
+
+// 點陣圖繪製模式（只影響點陣圖範圍內的像素）
+#define LCD_BLIT_COPY           0       // 覆蓋：與點陣圖相同
+#define LCD_BLIT_OR             1       // 點亮點陣圖為1的像素（同 draw_Bmp64x64()）
+#define LCD_BLIT_AND            2       // 只保留點陣圖為1的像素
+#define LCD_BLIT_XOR            3       // 反相點陣圖為1的像素，再畫一次即還原
+#define LCD_BLIT_INVERT         4       // 以反相的點陣圖覆蓋（白底黑字 <-> 黑底白字）
+#define LCD_BLIT_CLEAR          5       // 清除點陣圖為1的像素（以同一個遮罩擦除 LCD_BLIT_OR 畫的圖形）
+
+// 每次flush的傳輸統計
+typedef struct {
+    uint16_t data;          // 資料位元組數
+    uint16_t cmd;           // 位址命令位元組數
+    uint8_t spans;          // 送出的區段數（每個page最多1段）
+} LcdShadowStats;
+
+// 初始化：緩衝區清為0並送出整個畫面（取代 clear_LCD()）
+void LCD_shadowInit(void);
+
+// 標記整個畫面為dirty（LCD內容被其他函數改變時使用）
+void LCD_shadowInvalidate(void);
+
+// 繪圖（只修改緩衝區；超出畫面的部分忽略）
+void LCD_shadowClear(void);
+void LCD_shadowWrite(uint8_t page, uint8_t x, uint8_t value);
+uint8_t LCD_shadowRead(uint8_t page, uint8_t x);
+void LCD_shadowPixel(int16_t x, int16_t y, uint8_t color);
+
+// 矩形（含兩端點，座標順序不拘）：以page位元組加上下緣遮罩處理
+// 水平線/垂直線即 y0==y1 / x0==x1 的矩形
+void LCD_shadowFillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+void LCD_shadowClearRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void LCD_shadowInvertRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+// 圓形外框（與 draw_Circle() 相同的點）
+void LCD_shadowCircle(int16_t xc, int16_t yc, int16_t r, uint8_t color);
+
+// 點陣圖：格式與 draw_Bmp64x64() 相同（每頁w個位元組、共(h+7)/8頁、bit0在上），
+// (x, y) 為左上角像素座標，可為任意值（含負值），y不是8的倍數時每個位元組
+// 分成上下兩個page寫入；超出畫面的部分裁切
+void LCD_shadowBlit(int16_t x, int16_t y, const uint8_t *bmp, uint8_t w, uint8_t h, uint8_t mode);
+
+// 送出所有dirty區段，回傳本次SPI3傳送的位元組數（stats可為NULL）
+uint16_t LCD_shadowFlush(LcdShadowStats *stats);
+
+// 不送出，改把dirty區段依 LCD_shadowFlush() 的順序轉成SPI3傳送字組寫入
+// words（最多max個，放不下的page保持dirty），回傳字組數；供 LCD_Dma.c 以PDMA送出
+uint16_t LCD_shadowStage(uint16_t *words, uint16_t max, LcdShadowStats *stats);
+
+// 把 d[0..len-1] XOR 到第 page 頁 x 起的位元組並立即送出這一段（不經dirty範圍），
+// 回傳SPI3傳送的位元組數；用於已知改變範圍的資料（LCD_Delta.c 的差異幀），
+// 一個page內有多段改變時只送各段本身。超出畫面的部分忽略
+uint16_t LCD_shadowXorSpan(uint8_t page, int16_t x, const uint8_t *d, uint8_t len);
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * ================================================================
+ * LCD_Text.c: LCD文字行快取（只重畫改變的字元）
+ * 功能：每個字元格記錄畫面上的字元，與新字串逐格比較
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "LCD.h"
+#include "LCD_Text.h"
+
+// 未知內容（不會與任何可顯示字元相同）
+#define CELL_UNKNOWN    0
+
+static char s_cell[LCD_TEXT_LINES][LCD_TEXT_COLS];     // 畫面上每個格子的字元
+static uint32_t s_drawn = 0, s_skipped = 0;
+
+void LCD_textInit(void)
+{
+    memset(s_cell, ' ', sizeof(s_cell));
+    s_drawn = 0;
+    s_skipped = 0;
+}
+
+void LCD_textClear(void)
+{
+    clear_LCD();
+    memset(s_cell, ' ', sizeof(s_cell));
+}
+
+void LCD_textInvalidate(void)
+{
+    memset(s_cell, CELL_UNKNOWN, sizeof(s_cell));
+}
+
+/*
+ * ================================================================
+ * 顯示一行文字
+ * 功能：逐格比較，只有字元不同的格子以 printC() 重畫
+ * ================================================================
+ */
+uint8_t LCD_textLine(uint8_t line, const char *text)
+{
+    char *cell;
+    uint8_t i, n = 0;
+
+    if (line >= LCD_TEXT_LINES) return 0;
+    cell = s_cell[line];
+
+    for (i = 0; i < LCD_TEXT_COLS && text[i] != '\0'; i++) {
+        if (cell[i] == text[i]) {
+            s_skipped++;
+            continue;
+        }
+        printC(i * 8, line * 16, (unsigned char)text[i]);
+        cell[i] = text[i];
+        n++;
+    }
+    s_drawn += n;
+    return n;
+}
+
+void LCD_textStats(LcdTextStats *stats)
+{
+    stats->drawn = s_drawn;
+    stats->skipped = s_skipped;
+    stats->bytes_saved = s_skipped * LCD_TEXT_GLYPH_BYTES;
+}
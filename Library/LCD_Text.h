@@ -0,0 +1,56 @@
+/*
+ * ================================================================
+ * LCD_Text.h: LCD文字行快取（只重畫改變的字元）
+ * 功能：記錄 print_Line() 的4行x16格8x16字元目前顯示的內容，
+ *       寫入新的一行時只以 printC() 重畫與畫面上不同的字元
+ * 硬體：NUC100系列 + 128x64 LCD（LCD.c 的 printC()）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * print_Line() 每次都以 printC() 畫出整個字串，printC() 逐點呼叫
+ * draw_Pixel()，每個字元 8x16 個像素、每個像素 3+1 個SPI3位元組，
+ * 共512位元組；狀態列每5ms重畫一次相同的16個字元就是8KB。
+ *
+ * 使用方式：
+ *   init_LCD(); clear_LCD(); LCD_textInit();
+ *   LCD_textLine(line, text);       取代 print_Line(line, text)
+ *   LCD_textClear();                取代 clear_LCD()
+ *   其他函數直接畫到文字區域（printS、draw_Bmp64x64 等）之後需
+ *   LCD_textInvalidate()，下一次寫入時整行重畫
+ *
+ * 與 print_Line() 相同：只寫入字串長度內的格子（超過16個字元的部分忽略），
+ * 字串之後的格子保持原樣；需要清除時以空白補滿16格。
+ */
+
+#ifndef __LCD_TEXT_H__
+#define __LCD_TEXT_H__
+
+#include <stdint.h>
+
+#define LCD_TEXT_LINES          4       // 行數（每行16像素高）
+#define LCD_TEXT_COLS           16      // 每行字元數（每個字元8像素寬）
+#define LCD_TEXT_GLYPH_BYTES    512     // printC() 一個字元的SPI3位元組數（8x16像素 x 4）
+
+// 統計（累計值）
+typedef struct {
+    uint32_t drawn;         // 以 printC() 重畫的字元數
+    uint32_t skipped;       // 與畫面上相同而略過的字元數
+    uint32_t bytes_saved;   // 略過的字元省下的SPI3位元組數
+} LcdTextStats;
+
+// 初始化：畫面必須是空白（clear_LCD() 之後），所有格子視為空白
+void LCD_textInit(void);
+
+// 清除畫面（clear_LCD()）並把所有格子設為空白
+void LCD_textClear(void);
+
+// 畫面內容未知：下一次寫入時每個格子都重畫
+void LCD_textInvalidate(void);
+
+// 顯示一行文字（同 print_Line()），只重畫改變的字元，回傳重畫的字元數
+uint8_t LCD_textLine(uint8_t line, const char *text);
+
+// 讀取統計
+void LCD_textStats(LcdTextStats *stats);
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * ================================================================
+ * Segment_Frame.c: 七段顯示器雙緩衝畫面
+ * 功能：完整畫面發佈與掃描端切換
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include "Segment_Frame.h"
+
+/*
+ * ================================================================
+ * 開始寫入函數
+ * 功能：取消尚未切換的發佈，回傳掃描端不會讀取的畫面
+ * ================================================================
+ */
+volatile int8_t *Segment_frameBegin(SegmentFrame *f)
+{
+    f->pending = 0;                     // 之後掃描端不會切換 front
+    return f->buf[f->front ^ 1];
+}
+
+/*
+ * ================================================================
+ * 發佈函數
+ * 功能：標記畫面已完成，下一輪掃描開始時切換
+ * ================================================================
+ */
+void Segment_frameCommit(SegmentFrame *f)
+{
+    f->pending = 1;
+}
+
+void Segment_framePublish(SegmentFrame *f, const int8_t digits[SEG_FRAME_DIGITS])
+{
+    volatile int8_t *back = Segment_frameBegin(f);
+    uint8_t i;
+
+    for (i = 0; i < SEG_FRAME_DIGITS; i++) back[i] = digits[i];
+    Segment_frameCommit(f);
+}
+
+/*
+ * ================================================================
+ * 畫面切換函數（掃描中斷中呼叫）
+ * 功能：有新畫面時切換front，回傳本輪掃描使用的畫面
+ * ================================================================
+ */
+const volatile int8_t *Segment_frameLatch(SegmentFrame *f)
+{
+    if (f->pending) {
+        f->front ^= 1;
+        f->pending = 0;
+    }
+    return f->buf[f->front];
+}
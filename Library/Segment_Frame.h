@@ -0,0 +1,50 @@
+/*
+ * ================================================================
+ * Segment_Frame.h: 七段顯示器雙緩衝畫面
+ * 功能：主程式（或較低優先權中斷）寫入完整的4位數畫面後一次發佈，
+ *       掃描中斷只在每輪掃描開始時切換畫面，永遠不會顯示寫到一半的數字
+ * 硬體：NUC100系列（單核心，位元組存取為不可分割）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 使用方式：
+ *   寫入端：d = Segment_frameBegin(&f); d[0..3] = ...; Segment_frameCommit(&f);
+ *           （或以 Segment_framePublish(&f, digits) 一次完成）
+ *   掃描端：if (index == 0) frame = Segment_frameLatch(&f); 顯示 frame[index]
+ *
+ * 同步方式（不需關閉中斷）：
+ * - 掃描端只讀取 buf[front]，front 只在掃描端且 pending=1 時切換
+ * - 寫入端先把 pending 清為0（之後掃描端不會切換），才寫入 buf[front^1]
+ * - 寫完後 pending=1，下一輪掃描開始時才切換；尚未切換前再次發佈則以新畫面取代
+ * - 同一個畫面一次只能有一個寫入端
+ *
+ * 位數值：0-15 為數字，SEG_FRAME_BLANK(-1) 為空白；
+ * Segment_frameBegin() 回傳的緩衝區內容是舊畫面，4個位數都必須重新寫入。
+ */
+
+#ifndef __SEGMENT_FRAME_H__
+#define __SEGMENT_FRAME_H__
+
+#include <stdint.h>
+
+#define SEG_FRAME_DIGITS    4
+#define SEG_FRAME_BLANK     (-1)
+
+typedef struct {
+    volatile int8_t buf[2][SEG_FRAME_DIGITS];   // 兩個畫面（volatile：寫入不會被移到發佈之後）
+    volatile uint8_t front;                     // 掃描端顯示中的畫面（0/1）
+    volatile uint8_t pending;                   // 1=另一個畫面已寫好，等待切換
+} SegmentFrame;
+
+// 靜態初始化：兩個畫面的4個位數皆為v
+#define SEG_FRAME_INIT(v)   { { {v, v, v, v}, {v, v, v, v} }, 0, 0 }
+
+// 寫入端：取得可寫入的畫面 / 發佈
+volatile int8_t *Segment_frameBegin(SegmentFrame *f);
+void Segment_frameCommit(SegmentFrame *f);
+void Segment_framePublish(SegmentFrame *f, const int8_t digits[SEG_FRAME_DIGITS]);
+
+// 掃描端：每輪掃描開始（位數0）時呼叫，回傳本輪要顯示的畫面
+const volatile int8_t *Segment_frameLatch(SegmentFrame *f);
+
+#endif
@@ -0,0 +1,32 @@
+/*
+ * ================================================================
+ * Segment_FrameScan.c: 雙緩衝畫面的七段顯示器多工掃描
+ * 功能：消影、顯示目前位數、移到下一個位數
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include "Segment_Port.h"
+#include "Segment_FrameScan.h"
+
+/*
+ * ================================================================
+ * 掃描函數（掃描中斷中呼叫）
+ * 功能：每輪開始時切換到最新的完整畫面，關閉所有位數後顯示目前位數
+ * ================================================================
+ */
+void Segment_frameScan(SegmentFrameScan *s)
+{
+    uint8_t no = s->index;
+
+    if (no == 0) s->digits = Segment_frameLatch(s->frame);
+
+    CloseSevenSegment();                            // 消影
+    if (s->digits[no] != SEG_FRAME_BLANK) {
+        ShowSevenSegment(no, (uint8_t)s->digits[no]);
+    }
+
+    no++;
+    if (no >= SEG_FRAME_DIGITS) no = 0;
+    s->index = no;
+}
@@ -0,0 +1,37 @@
+/*
+ * ================================================================
+ * Segment_FrameScan.h: 雙緩衝畫面的七段顯示器多工掃描
+ * 功能：掃描中斷每次呼叫一次，關閉所有位數後顯示下一個位數；
+ *       每輪掃描開始（位數0）時以 Segment_frameLatch() 取得完整畫面
+ * 硬體：Nu-LB-NUC140開發板（PC4-7位選、PE0-7段選）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 掃描用的Timer與中斷旗標由呼叫端處理，例如：
+ *   SegmentFrameScan g_Scan = SEG_FRAME_SCAN_INIT(g_Display);
+ *   void TMR0_IRQHandler(void) { TIMER0->TISR = 1; Segment_frameScan(&g_Scan); }
+ *
+ * 值為 SEG_FRAME_BLANK 的位數不顯示。需要 Segment_Port.c
+ * （CloseSevenSegment()/ShowSevenSegment()）與 Segment_Frame.c。
+ * Tools/SegEmu 直接編譯本檔執行 Lab 9/10 的掃描情境。
+ */
+
+#ifndef __SEGMENT_FRAMESCAN_H__
+#define __SEGMENT_FRAMESCAN_H__
+
+#include <stdint.h>
+#include "Segment_Frame.h"
+
+typedef struct {
+    SegmentFrame *frame;                // 掃描的畫面
+    const volatile int8_t *digits;      // 本輪掃描顯示的4個位數
+    uint8_t index;                      // 下一次掃描的位數（0=最右邊 ... 3=最左邊）
+} SegmentFrameScan;
+
+// 靜態初始化：掃描畫面f，從位數0開始
+#define SEG_FRAME_SCAN_INIT(f)  { &(f), 0, 0 }
+
+// 掃描一個位數（由掃描Timer的中斷呼叫）
+void Segment_frameScan(SegmentFrameScan *s);
+
+#endif
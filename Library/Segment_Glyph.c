@@ -0,0 +1,33 @@
+/*
+ * ================================================================
+ * Segment_Glyph.c: 七段顯示器字形表
+ * 功能：以Segment_Glyph.h的編譯期巨集建立字形表，並提供字元查表
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include "Segment_Glyph.h"
+
+// 十六進制數字與負號（放在Flash，不佔用SRAM）
+const uint8_t SEG_GLYPH_HEX[SEG_GLYPH_HEX_COUNT] = SEG_GLYPH_HEX_TABLE;
+
+// 字母A-Z
+const uint8_t SEG_GLYPH_ALPHA[26] = SEG_GLYPH_ALPHA_TABLE;
+
+/*
+ * ================================================================
+ * 字元轉字形函數
+ * 功能：將ASCII字元轉為可直接寫入PE->DOUT的段碼
+ * 參數：c - 字元
+ * 回傳：段碼（不支援的字元回傳空白）
+ * ================================================================
+ */
+uint8_t Segment_glyphFromChar(char c)
+{
+    if (c >= '0' && c <= '9') return SEG_GLYPH_HEX[c - '0'];
+    if (c >= 'A' && c <= 'Z') return SEG_GLYPH_ALPHA[c - 'A'];
+    if (c >= 'a' && c <= 'z') return SEG_GLYPH_ALPHA[c - 'a'];
+    if (c == '-') return SEG_GLYPH_MINUS;
+    return SEG_GLYPH_BLANK;
+}
@@ -0,0 +1,153 @@
+/*
+ * ================================================================
+ * Segment_Glyph.h: 七段顯示器接線與字形表定義
+ * 功能：集中描述PE0-7與各段的接線，並在編譯期產生所有字形的
+ *       PE->DOUT寫入值（數字、十六進制、負號、空白、字母）
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 實際接線（Lab 3、Lab 5 的段碼皆依此接線，低電位點亮）：
+ * PE7=G, PE6=E, PE5=D, PE4=B, PE3=A, PE2=F, PE1=DP, PE0=C
+ *
+ *      A
+ *    F   B
+ *      G
+ *    E   C
+ *      D   DP
+ *
+ * 使用方式：
+ * - SEG_GLYPH_x 皆為常數運算式，可直接用於陣列初始值或寫入PE->DOUT
+ * - 更換接線時只需修改 SEG_BIT_x 與 SEG_ACTIVE_LOW
+ */
+
+#ifndef __SEGMENT_GLYPH_H__
+#define __SEGMENT_GLYPH_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 接線描述：各段對應的PE位元編號
+// ================================================================
+#define SEG_BIT_A       3       // PE3
+#define SEG_BIT_B       4       // PE4
+#define SEG_BIT_C       0       // PE0
+#define SEG_BIT_D       5       // PE5
+#define SEG_BIT_E       6       // PE6
+#define SEG_BIT_F       2       // PE2
+#define SEG_BIT_G       7       // PE7
+#define SEG_BIT_DP      1       // PE1
+#define SEG_ACTIVE_LOW  1       // 1=低電位點亮, 0=高電位點亮
+
+// ================================================================
+// 單段遮罩（邏輯上「點亮」的位元）
+// ================================================================
+#define SEG_A   (1u << SEG_BIT_A)
+#define SEG_B   (1u << SEG_BIT_B)
+#define SEG_C   (1u << SEG_BIT_C)
+#define SEG_D   (1u << SEG_BIT_D)
+#define SEG_E   (1u << SEG_BIT_E)
+#define SEG_F   (1u << SEG_BIT_F)
+#define SEG_G   (1u << SEG_BIT_G)
+#define SEG_DP  (1u << SEG_BIT_DP)
+
+// 將「點亮的段」轉換為PE->DOUT寫入值（編譯期完成，執行時不需位元重排）
+#if SEG_ACTIVE_LOW
+#define SEG_PORT(on)    ((uint8_t)(~(on) & 0xFFu))
+#else
+#define SEG_PORT(on)    ((uint8_t)((on) & 0xFFu))
+#endif
+
+// ================================================================
+// 數字字形 0-9
+// ================================================================
+#define SEG_GLYPH_0     SEG_PORT(SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F)
+#define SEG_GLYPH_1     SEG_PORT(SEG_B | SEG_C)
+#define SEG_GLYPH_2     SEG_PORT(SEG_A | SEG_B | SEG_D | SEG_E | SEG_G)
+#define SEG_GLYPH_3     SEG_PORT(SEG_A | SEG_B | SEG_C | SEG_D | SEG_G)
+#define SEG_GLYPH_4     SEG_PORT(SEG_B | SEG_C | SEG_F | SEG_G)
+#define SEG_GLYPH_5     SEG_PORT(SEG_A | SEG_C | SEG_D | SEG_F | SEG_G)
+#define SEG_GLYPH_6     SEG_PORT(SEG_A | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_7     SEG_PORT(SEG_A | SEG_B | SEG_C)
+#define SEG_GLYPH_8     SEG_PORT(SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_9     SEG_PORT(SEG_A | SEG_B | SEG_C | SEG_F | SEG_G)   // 無下橫（與原SEG_N9相同）
+
+// ================================================================
+// 十六進制字形 A-F（b、d為小寫以便與8、0區分）
+// ================================================================
+#define SEG_GLYPH_HEX_A SEG_PORT(SEG_A | SEG_B | SEG_C | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_HEX_B SEG_PORT(SEG_C | SEG_D | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_HEX_C SEG_PORT(SEG_A | SEG_D | SEG_E | SEG_F)
+#define SEG_GLYPH_HEX_D SEG_PORT(SEG_B | SEG_C | SEG_D | SEG_E | SEG_G)
+#define SEG_GLYPH_HEX_E SEG_PORT(SEG_A | SEG_D | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_HEX_F SEG_PORT(SEG_A | SEG_E | SEG_F | SEG_G)
+
+// ================================================================
+// 符號字形
+// ================================================================
+#define SEG_GLYPH_MINUS SEG_PORT(SEG_G)
+#define SEG_GLYPH_BLANK SEG_PORT(0)
+
+// ================================================================
+// 字母字形（七段可辨識的近似寫法）
+// ================================================================
+#define SEG_GLYPH_A     SEG_GLYPH_HEX_A
+#define SEG_GLYPH_B     SEG_GLYPH_HEX_B
+#define SEG_GLYPH_C     SEG_GLYPH_HEX_C
+#define SEG_GLYPH_D     SEG_GLYPH_HEX_D
+#define SEG_GLYPH_E     SEG_GLYPH_HEX_E
+#define SEG_GLYPH_F     SEG_GLYPH_HEX_F
+#define SEG_GLYPH_G     SEG_PORT(SEG_A | SEG_C | SEG_D | SEG_E | SEG_F)
+#define SEG_GLYPH_H     SEG_PORT(SEG_B | SEG_C | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_I     SEG_PORT(SEG_E | SEG_F)
+#define SEG_GLYPH_J     SEG_PORT(SEG_B | SEG_C | SEG_D | SEG_E)
+#define SEG_GLYPH_K     SEG_PORT(SEG_B | SEG_C | SEG_E | SEG_F | SEG_G)   // 同H
+#define SEG_GLYPH_L     SEG_PORT(SEG_D | SEG_E | SEG_F)
+#define SEG_GLYPH_M     SEG_PORT(SEG_A | SEG_C | SEG_E)
+#define SEG_GLYPH_N     SEG_PORT(SEG_C | SEG_E | SEG_G)
+#define SEG_GLYPH_O     SEG_GLYPH_0
+#define SEG_GLYPH_P     SEG_PORT(SEG_A | SEG_B | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_Q     SEG_PORT(SEG_A | SEG_B | SEG_C | SEG_F | SEG_G)
+#define SEG_GLYPH_R     SEG_PORT(SEG_E | SEG_G)
+#define SEG_GLYPH_S     SEG_GLYPH_5
+#define SEG_GLYPH_T     SEG_PORT(SEG_D | SEG_E | SEG_F | SEG_G)
+#define SEG_GLYPH_U     SEG_PORT(SEG_B | SEG_C | SEG_D | SEG_E | SEG_F)
+#define SEG_GLYPH_V     SEG_PORT(SEG_C | SEG_D | SEG_E)
+#define SEG_GLYPH_W     SEG_PORT(SEG_B | SEG_D | SEG_F)
+#define SEG_GLYPH_X     SEG_GLYPH_H
+#define SEG_GLYPH_Y     SEG_PORT(SEG_B | SEG_C | SEG_D | SEG_F | SEG_G)
+#define SEG_GLYPH_Z     SEG_GLYPH_2
+
+// ================================================================
+// 表格初始值（供 uint8_t 陣列初始化使用）
+// ================================================================
+// 索引0-15為十六進制數字，16為負號（與Lab 5.2的MINUS_CODE相同）
+#define SEG_GLYPH_HEX_TABLE {                                       \
+    SEG_GLYPH_0, SEG_GLYPH_1, SEG_GLYPH_2, SEG_GLYPH_3,             \
+    SEG_GLYPH_4, SEG_GLYPH_5, SEG_GLYPH_6, SEG_GLYPH_7,             \
+    SEG_GLYPH_8, SEG_GLYPH_9, SEG_GLYPH_HEX_A, SEG_GLYPH_HEX_B,     \
+    SEG_GLYPH_HEX_C, SEG_GLYPH_HEX_D, SEG_GLYPH_HEX_E, SEG_GLYPH_HEX_F, \
+    SEG_GLYPH_MINUS }
+#define SEG_GLYPH_HEX_COUNT     17
+#define SEG_GLYPH_MINUS_CODE    16
+
+// 字母A-Z
+#define SEG_GLYPH_ALPHA_TABLE {                                     \
+    SEG_GLYPH_A, SEG_GLYPH_B, SEG_GLYPH_C, SEG_GLYPH_D, SEG_GLYPH_E, \
+    SEG_GLYPH_F, SEG_GLYPH_G, SEG_GLYPH_H, SEG_GLYPH_I, SEG_GLYPH_J, \
+    SEG_GLYPH_K, SEG_GLYPH_L, SEG_GLYPH_M, SEG_GLYPH_N, SEG_GLYPH_O, \
+    SEG_GLYPH_P, SEG_GLYPH_Q, SEG_GLYPH_R, SEG_GLYPH_S, SEG_GLYPH_T, \
+    SEG_GLYPH_U, SEG_GLYPH_V, SEG_GLYPH_W, SEG_GLYPH_X, SEG_GLYPH_Y, \
+    SEG_GLYPH_Z }
+
+// ================================================================
+// 函數宣告（Segment_Glyph.c）
+// ================================================================
+extern const uint8_t SEG_GLYPH_HEX[SEG_GLYPH_HEX_COUNT];
+extern const uint8_t SEG_GLYPH_ALPHA[26];
+
+// 將字元（'0'-'9'、'A'-'Z'、'a'-'z'、'-'、' '）轉為PE->DOUT寫入值
+// 不支援的字元以空白顯示
+uint8_t Segment_glyphFromChar(char c);
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * ================================================================
+ * Segment_Marquee.c: 七段顯示器跑馬燈引擎
+ * 功能：以掃描tick步進的字串循環滾動
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <stdio.h>
+#include "NUC100Series.h"
+#include "Segment_Glyph.h"
+#include "Segment_Scan.h"
+#include "Segment_Marquee.h"
+
+// ---------------- 跑馬燈狀態 ----------------
+static uint8_t s_text[SEG_MARQUEE_MAX_LEN];     // 字串段碼（設定時轉換一次）
+static uint8_t s_len = 0;                       // 字串長度（至少SEG_SCAN_DIGITS）
+static uint8_t s_pos = 0;                       // 最左邊位數顯示的字元位置
+static int8_t s_dir = SEG_MARQUEE_FORWARD;      // 滾動方向
+static volatile uint8_t s_running = 0;          // 1=滾動中（主程式會讀取）
+static uint16_t s_period = SEG_SCAN_TICK_HZ;    // 步進週期（tick，預設1秒）
+static uint16_t s_count = 0;                    // 距上次步進的tick數
+
+/*
+ * ================================================================
+ * 鎖定函數
+ * 功能：主程式修改狀態時暫停Timer2中斷，避免與tick中的步進交錯；
+ *       解除時恢復原本的致能狀態（Segment_scanInit()之前呼叫不會
+ *       提早開啟中斷，巢狀呼叫也不會在外層結束前開啟）
+ * ================================================================
+ */
+static uint8_t marquee_lock(void)
+{
+    uint8_t enabled = (uint8_t)((NVIC->ISER[0] >> ((uint32_t)TMR2_IRQn & 0x1F)) & 0x01);
+
+    NVIC_DisableIRQ(TMR2_IRQn);
+    return enabled;
+}
+
+static void marquee_unlock(uint8_t enabled)
+{
+    if (enabled) NVIC_EnableIRQ(TMR2_IRQn);
+}
+
+/*
+ * ================================================================
+ * 畫面更新函數
+ * 功能：將目前位置起的4個字元寫入掃描緩衝區（位數3=最左邊）
+ * ================================================================
+ */
+static void marquee_render(void)
+{
+    uint8_t index = s_pos;
+    int8_t no;
+
+    for (no = SEG_SCAN_DIGITS - 1; no >= 0; no--) {
+        Segment_setPattern((uint8_t)no, s_text[index]);
+        index++;
+        if (index >= s_len) index = 0;
+    }
+}
+
+/*
+ * ================================================================
+ * 位置移動函數
+ * ================================================================
+ */
+static void marquee_advance(int8_t direction)
+{
+    if (direction > 0) {
+        s_pos++;
+        if (s_pos >= s_len) s_pos = 0;
+    } else {
+        if (s_pos == 0) s_pos = s_len;
+        s_pos--;
+    }
+    marquee_render();
+}
+
+/*
+ * ================================================================
+ * tick函數（在Timer2中斷中執行）
+ * ================================================================
+ */
+static void marquee_tick(void)
+{
+    if (!s_running) return;
+
+    s_count++;
+    if (s_count >= s_period) {
+        s_count = 0;
+        marquee_advance(s_dir);
+    }
+}
+
+/*
+ * ================================================================
+ * 字串設定函數
+ * 功能：轉換為段碼、位置歸0並暫停
+ * 回傳：1=整個字串都已使用，0=超過SEG_MARQUEE_MAX_LEN被截斷
+ * ================================================================
+ */
+uint8_t Segment_marqueeSetText(const char *text)
+{
+    uint8_t len = 0, complete;
+    uint8_t irq = marquee_lock();
+
+    while (text[len] != '\0' && len < SEG_MARQUEE_MAX_LEN) {
+        s_text[len] = Segment_glyphFromChar(text[len]);
+        len++;
+    }
+    complete = (uint8_t)(text[len] == '\0');  // 0=其餘字元被捨棄
+    while (len < SEG_SCAN_DIGITS) {
+        s_text[len++] = SEG_GLYPH_BLANK;    // 不足4個字元補空白
+    }
+    s_len = len;
+    s_pos = 0;
+    s_dir = SEG_MARQUEE_FORWARD;
+    s_running = 0;
+    s_count = 0;
+    marquee_render();
+    Segment_scanSetHook(marquee_tick);
+    marquee_unlock(irq);
+
+    return complete;
+}
+
+/*
+ * ================================================================
+ * 步進週期設定函數
+ * 參數：period_ms - 每步的毫秒數（最小為1個tick）
+ * ================================================================
+ */
+void Segment_marqueeSetPeriod(uint16_t period_ms)
+{
+    uint32_t ticks = (uint32_t)period_ms * SEG_SCAN_TICK_HZ / 1000;
+    uint8_t irq;
+
+    if (ticks == 0) ticks = 1;
+    if (ticks > 0xFFFF) ticks = 0xFFFF;
+
+    irq = marquee_lock();
+    s_period = (uint16_t)ticks;
+    s_count = 0;
+    marquee_unlock(irq);
+}
+
+/*
+ * ================================================================
+ * 滾動控制函數
+ * ================================================================
+ */
+void Segment_marqueeRun(int8_t direction)
+{
+    uint8_t irq = marquee_lock();
+
+    s_dir = (direction < 0) ? SEG_MARQUEE_BACKWARD : SEG_MARQUEE_FORWARD;
+    s_running = 1;
+    s_count = 0;                            // 重新計時
+    marquee_unlock(irq);
+}
+
+void Segment_marqueeStep(int8_t direction)
+{
+    uint8_t irq = marquee_lock();
+
+    marquee_advance(direction);
+    marquee_unlock(irq);
+}
+
+void Segment_marqueePause(void)
+{
+    s_running = 0;                          // 單一位元組寫入，不需鎖定
+}
+
+void Segment_marqueeReset(void)
+{
+    uint8_t irq = marquee_lock();
+
+    s_pos = 0;
+    s_dir = SEG_MARQUEE_FORWARD;
+    s_running = 0;
+    s_count = 0;
+    marquee_render();
+    marquee_unlock(irq);
+}
+
+uint8_t Segment_marqueeRunning(void)
+{
+    return s_running;
+}
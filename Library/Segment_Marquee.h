@@ -0,0 +1,56 @@
+/*
+ * ================================================================
+ * Segment_Marquee.h: 七段顯示器跑馬燈引擎
+ * 功能：將任意字串（字母、數字、負號、空白）在4位數七段顯示器上循環滾動
+ * 硬體：Nu-LB-NUC140開發板（需先呼叫Segment_scanInit()）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 滾動在Segment_Scan的Timer2 tick中進行，步進週期以tick計算，
+ * 速度精確且不佔用主迴圈時間；主程式只需呼叫控制函數。
+ *
+ * 顯示方式：
+ * - 字串首尾相接循環，最左邊(位數3)顯示目前位置的字元
+ * - 字串不足4個字元時以空白補足
+ * - 最多SEG_MARQUEE_MAX_LEN(32)個字元，超過的部分捨棄，
+ *   Segment_marqueeSetText() 回傳0
+ * - FORWARD：每步位置+1（下一個字元從右邊進入）
+ * - BACKWARD：每步位置-1（前一個字元從左邊進入）
+ */
+
+#ifndef __SEGMENT_MARQUEE_H__
+#define __SEGMENT_MARQUEE_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 參數設定
+// ================================================================
+#define SEG_MARQUEE_MAX_LEN     32      // 字串最大長度（超過時截斷）
+#define SEG_MARQUEE_FORWARD     1       // 位置遞增
+#define SEG_MARQUEE_BACKWARD    (-1)    // 位置遞減
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 設定字串（位置歸0、暫停），並掛上掃描tick；
+// 回傳1=整個字串都已使用，0=超過SEG_MARQUEE_MAX_LEN，其餘字元被捨棄
+uint8_t Segment_marqueeSetText(const char *text);
+
+// 設定步進週期（毫秒）
+void Segment_marqueeSetPeriod(uint16_t period_ms);
+
+// 以指定方向開始滾動（從現在起滿一個週期才步進）
+void Segment_marqueeRun(int8_t direction);
+
+// 立即移動一步（不改變執行狀態）
+void Segment_marqueeStep(int8_t direction);
+
+// 暫停 / 重置（位置歸0、暫停、方向FORWARD）
+void Segment_marqueePause(void);
+void Segment_marqueeReset(void);
+
+// 是否滾動中
+uint8_t Segment_marqueeRunning(void);
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * ================================================================
+ * Segment_Port.c: 七段顯示器腳位驅動（DMASK單次寫入）
+ * 功能：七段顯示器的初始化、顯示和關閉，每個位數只寫入
+ *       PE->DOUT（段選）與PC->DOUT（位選）各一次
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 七段顯示器段對應（低電位點亮，定義於Segment_Glyph.h）：
+ * PE7=G, PE6=E, PE5=D, PE4=B, PE3=A, PE2=F, PE1=DP, PE0=C
+ */
+
+#include <stdio.h>
+#include "NUC100Series.h"
+#include "GPIO.h"
+#include "SYS.h"
+#include "Segment_Glyph.h"
+#include "Segment_Port.h"
+
+void OpenSevenSegment(void)
+{
+    // 位選腳位（PC4-7）：輸出模式
+    GPIO_SetMode(PC, BIT4, GPIO_PMD_OUTPUT);
+    GPIO_SetMode(PC, BIT5, GPIO_PMD_OUTPUT);
+    GPIO_SetMode(PC, BIT6, GPIO_PMD_OUTPUT);
+    GPIO_SetMode(PC, BIT7, GPIO_PMD_OUTPUT);
+
+    // 段選腳位（PE0-7）：準雙向模式
+    GPIO_SetMode(PE, BIT0, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT1, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT2, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT3, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT4, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT5, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT6, GPIO_PMD_QUASI);
+    GPIO_SetMode(PE, BIT7, GPIO_PMD_QUASI);
+
+    // 寫入遮罩：DMASK為1的位元不受DOUT寫入影響
+    PE->DMASK = ~SEG_PE_MASK;
+    PC->DMASK = ~SEG_PC_MASK;
+
+    // 初始關閉所有位選與段（低電位關閉）
+    PC->DOUT = 0;
+    PE->DOUT = 0;
+}
+
+void ShowSevenSegment(uint8_t no, uint8_t number)
+{
+    ShowSevenSegmentPattern(no, SEG_GLYPH_HEX[number]);
+}
+
+void ShowSevenSegmentPattern(uint8_t no, uint8_t pattern)
+{
+    // 整個位數的段模式一次寫入PE0-7（受DMASK保護，其他腳位不變）
+    PE->DOUT = pattern;
+
+    // 只啟用指定的顯示器位置，同時關閉其餘三個位選
+    PC->DOUT = (uint32_t)0x01 << (SEG_PC_SHIFT + no);
+}
+
+void CloseSevenSegment(void)
+{
+    PC->DOUT = 0;
+}
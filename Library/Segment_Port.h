@@ -0,0 +1,52 @@
+/*
+ * ================================================================
+ * Segment_Port.h: 七段顯示器腳位驅動（DMASK單次寫入）
+ * 功能：提供與BSP Seven_Segment.h 相同的 OpenSevenSegment()、
+ *       ShowSevenSegment()、CloseSevenSegment()，另加直接寫入段碼的
+ *       ShowSevenSegmentPattern()；字形表使用 Segment_Glyph.c
+ * 硬體：Nu-LB-NUC140開發板（PC4-7位選、PE0-7段選）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 初始化時設定PE、PC的DMASK，只開放PE0-7與PC4-7可被DOUT寫入，
+ * 之後每次顯示只需對PE->DOUT、PC->DOUT各做一次寫入，
+ * 不會影響同一埠上的其他腳位（例如PC0按鈕、PC12-15 LED）。
+ *
+ * 與原本逐腳位寫入的驅動的差別：ShowSevenSegment()/ShowSevenSegmentPattern()
+ * 以一次寫入設定PC4-7，指定位數以外的三個位選同時被關閉；原本只把指定
+ * 位數的位選設為1，其他位選維持原狀。掃描程式都在顯示前先呼叫
+ * CloseSevenSegment()，結果相同（Tools/SegEmu -c 逐一比對）。
+ *
+ * 使用方式：以本檔與 Segment_Glyph.c 取代專案中的 Seven_Segment.c
+ * （Lab 5.1/5.2 原本各有一份）；Lab 程式仍可 #include "Seven_Segment.h"。
+ */
+
+#ifndef __SEGMENT_PORT_H__
+#define __SEGMENT_PORT_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 腳位遮罩
+// ================================================================
+#define SEG_PE_MASK     0x000000FFu     // PE0-7：段選
+#define SEG_PC_MASK     0x000000F0u     // PC4-7：位選
+#define SEG_PC_SHIFT    4               // 位選從PC4開始
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 設定PC4-7為輸出、PE0-7為準雙向，設定DMASK並關閉所有位數
+void OpenSevenSegment(void);
+
+// 在位置 no（0=最右邊PC4 ... 3=最左邊PC7）顯示十六進制數字0-15或負號16
+// （SEG_GLYPH_MINUS_CODE）
+void ShowSevenSegment(uint8_t no, uint8_t number);
+
+// 在位置 no 直接顯示段碼（PE->DOUT寫入值，例如 Segment_Glyph.h 的 SEG_GLYPH_x）
+void ShowSevenSegmentPattern(uint8_t no, uint8_t pattern);
+
+// 關閉所有位數（PC4-7一次寫0）
+void CloseSevenSegment(void);
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * ================================================================
+ * Segment_Scan.c: 七段顯示器背景掃描引擎
+ * 功能：Timer2中斷多工掃描、4位數顯示緩衝區、每位數亮度控制
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 取代Lab 3/4/5中主迴圈以CLK_SysTickDelay()輪流點亮4個位數的作法：
+ * 原本每圈約20ms都耗在延遲上，改用中斷後主迴圈只需數微秒。
+ */
+
+#include <stdio.h>
+#include "NUC100Series.h"
+#include "SYS.h"
+#include "Segment_Port.h"
+#include "Segment_Glyph.h"
+#include "Segment_Scan.h"
+
+// ---------------- 掃描狀態 ----------------
+static volatile uint8_t s_frame[SEG_SCAN_DIGITS] = {
+    SEG_GLYPH_BLANK, SEG_GLYPH_BLANK, SEG_GLYPH_BLANK, SEG_GLYPH_BLANK
+};
+static volatile uint8_t s_level[SEG_SCAN_DIGITS] = {
+    SEG_SCAN_LEVELS, SEG_SCAN_LEVELS, SEG_SCAN_LEVELS, SEG_SCAN_LEVELS
+};
+static volatile uint32_t s_ticks = 0;   // tick計數（時基）
+static uint8_t s_digit = 0;             // 目前掃描的位數（僅中斷使用）
+static uint8_t s_sub = 0;               // 目前位數時段內的tick（僅中斷使用）
+static SegmentScanHook s_hook = 0;      // 每tick呼叫的附加函數（如跑馬燈）
+
+/*
+ * ================================================================
+ * 掃描初始化函數
+ * 功能：開啟七段顯示器並設定Timer2為週期模式
+ * ================================================================
+ */
+void Segment_scanInit(void)
+{
+    OpenSevenSegment();                                         // GPIO與DMASK設定
+
+    CLK_EnableModuleClock(TMR2_MODULE);                         // 啟用 Timer2 時鐘
+    CLK_SetModuleClock(TMR2_MODULE, CLK_CLKSEL1_TMR2_S_HXT, 0); // 時鐘源為 HXT
+    TIMER_Open(TIMER2, TIMER_PERIODIC_MODE, SEG_SCAN_TICK_HZ);  // 週期模式
+    TIMER_EnableInt(TIMER2);                                    // 啟用 Timer2 中斷
+    NVIC_EnableIRQ(TMR2_IRQn);                                  // 在 NVIC 中啟用
+    TIMER_Start(TIMER2);                                        // 啟動 Timer2
+}
+
+/*
+ * ================================================================
+ * Timer2中斷服務程式
+ * ================================================================
+ */
+void TMR2_IRQHandler(void)
+{
+    Segment_scanTick();
+    TIMER_ClearIntFlag(TIMER2);
+}
+
+/*
+ * ================================================================
+ * 掃描tick函數
+ * 功能：位數時段開始時點亮該位數，點亮tick數達到亮度設定後熄滅
+ * ================================================================
+ */
+void Segment_scanTick(void)
+{
+    uint8_t level = s_level[s_digit];
+
+    if (s_sub == 0) {
+        // 先關閉位選再換段碼，避免上一位數出現殘影
+        CloseSevenSegment();
+        if (level != 0 && s_frame[s_digit] != SEG_GLYPH_BLANK) {
+            ShowSevenSegmentPattern(s_digit, s_frame[s_digit]);
+        }
+    } else if (s_sub == level) {
+        // 亮度時間到，熄滅剩餘時段
+        CloseSevenSegment();
+    }
+
+    // 前進到下一個tick / 下一個位數
+    s_sub++;
+    if (s_sub >= SEG_SCAN_LEVELS) {
+        s_sub = 0;
+        s_digit++;
+        if (s_digit >= SEG_SCAN_DIGITS) s_digit = 0;
+    }
+
+    if (s_hook) s_hook();
+
+    s_ticks++;
+}
+
+/*
+ * ================================================================
+ * 附加函數設定
+ * 功能：在每個掃描tick（中斷內）呼叫hook，0表示取消
+ * ================================================================
+ */
+void Segment_scanSetHook(SegmentScanHook hook)
+{
+    s_hook = hook;
+}
+
+/*
+ * ================================================================
+ * tick計數讀取函數
+ * ================================================================
+ */
+uint32_t Segment_scanTicks(void)
+{
+    return s_ticks;
+}
+
+/*
+ * ================================================================
+ * 顯示緩衝區更新函數
+ * ================================================================
+ */
+void Segment_setPattern(uint8_t no, uint8_t pattern)
+{
+    if (no < SEG_SCAN_DIGITS) s_frame[no] = pattern;
+}
+
+void Segment_setDigit(uint8_t no, uint8_t number)
+{
+    if (number < SEG_GLYPH_HEX_COUNT) Segment_setPattern(no, SEG_GLYPH_HEX[number]);
+}
+
+void Segment_showNumber(uint16_t value)
+{
+    // 只在數值改變時由主程式呼叫，因此直接使用除法
+    s_frame[0] = SEG_GLYPH_HEX[value % 10];
+    s_frame[1] = SEG_GLYPH_HEX[(value / 10) % 10];
+    s_frame[2] = SEG_GLYPH_HEX[(value / 100) % 10];
+    s_frame[3] = SEG_GLYPH_HEX[(value / 1000) % 10];
+}
+
+void Segment_clear(void)
+{
+    uint8_t i;
+    for (i = 0; i < SEG_SCAN_DIGITS; i++) s_frame[i] = SEG_GLYPH_BLANK;
+}
+
+/*
+ * ================================================================
+ * 亮度設定函數
+ * 參數：no - 位數(0-3), level - 0(熄滅) 至 SEG_SCAN_LEVELS(全亮)
+ * ================================================================
+ */
+void Segment_setBrightness(uint8_t no, uint8_t level)
+{
+    if (no >= SEG_SCAN_DIGITS) return;
+    if (level > SEG_SCAN_LEVELS) level = SEG_SCAN_LEVELS;
+    s_level[no] = level;
+}
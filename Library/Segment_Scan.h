@@ -0,0 +1,61 @@
+/*
+ * ================================================================
+ * Segment_Scan.h: 七段顯示器背景掃描引擎
+ * 功能：以Timer2中斷自動多工掃描4位數七段顯示器，
+ *       主程式只需更新顯示緩衝區即可立即返回
+ * 硬體：Nu-LB-NUC140開發板（PC4-7位選、PE0-7段選、TIMER2）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 掃描時序：
+ * - 每個位數佔 SEG_SCAN_LEVELS 個tick，整個畫面 4*SEG_SCAN_LEVELS 個tick
+ * - 預設 SEG_SCAN_TICK_HZ=4000 → 每位數2ms，畫面更新率125Hz
+ * - 亮度 = 位數在自己的時段內點亮的tick數（0=熄滅, SEG_SCAN_LEVELS=全亮）
+ *
+ * 位數編號與ShowSevenSegment()相同：0=最右邊(PC4) ... 3=最左邊(PC7)
+ *
+ * 需要 Segment_Port.c（ShowSevenSegmentPattern()）與 Segment_Glyph.c；
+ * BSP的 Seven_Segment.c 沒有 ShowSevenSegmentPattern()，專案中須以
+ * Segment_Port.c 取代，否則連結失敗。
+ */
+
+#ifndef __SEGMENT_SCAN_H__
+#define __SEGMENT_SCAN_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 參數設定
+// ================================================================
+#define SEG_SCAN_DIGITS     4       // 位數
+#define SEG_SCAN_LEVELS     8       // 亮度階數（每位數時段的tick數）
+#define SEG_SCAN_TICK_HZ    4000    // Timer2中斷頻率
+
+// 每tick在中斷中呼叫的附加函數型別（須短小，不可等待）
+typedef void (*SegmentScanHook)(void);
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 初始化七段顯示器與Timer2，開始背景掃描
+void Segment_scanInit(void);
+
+// 掃描一個tick（由TMR2_IRQHandler呼叫；已有掃描Timer的程式也可自行呼叫）
+void Segment_scanTick(void);
+
+// 設定每tick呼叫的附加函數（0=取消），例如跑馬燈步進
+void Segment_scanSetHook(SegmentScanHook hook);
+
+// 取得掃描tick計數（每 1/SEG_SCAN_TICK_HZ 秒加1，可作為主程式時基）
+uint32_t Segment_scanTicks(void);
+
+// 顯示緩衝區更新（皆立即返回，由中斷負責顯示）
+void Segment_setPattern(uint8_t no, uint8_t pattern);  // 直接設定段碼
+void Segment_setDigit(uint8_t no, uint8_t number);     // 設定十六進制數字0-15或負號16
+void Segment_showNumber(uint16_t value);               // 顯示0-9999（4位數含前導0）
+void Segment_clear(void);                              // 全部空白
+
+// 亮度控制：level 0-SEG_SCAN_LEVELS
+void Segment_setBrightness(uint8_t no, uint8_t level);
+
+#endif
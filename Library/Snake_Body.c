@@ -0,0 +1,167 @@
+/*
+ * ================================================================
+ * Snake_Body.c: 貪食蛇蛇身方向格子
+ * 功能：加入頭時寫入舊的頭的方向碼、移除尾巴時沿方向碼移動尾巴，
+ *       同時維護佔用表與每列佔用數；依每列佔用數選出隨機空格
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "Snake_Body.h"
+
+// 佔用表中 (x, y) 所在的位元組與位元（x、y 必須在盤面內）
+#define OCC_BYTE(x, y)  ((uint16_t)(y) * (SNAKE_GRID_W / 8) + ((uint8_t)(x) >> 3))
+#define OCC_BIT(x)      (1u << ((x) & 7))
+
+// 方向碼中 (x, y) 所在的位元組與位移（每個位元組4格）
+#define DIR_BYTE(x, y)  ((uint16_t)(y) * (SNAKE_GRID_W / 4) + ((uint8_t)(x) >> 2))
+#define DIR_SHIFT(x)    (((x) & 3) << 1)
+
+// 方向碼對應的座標變化
+static const int8_t s_dx[4] = { 1, 0, -1, 0 };
+static const int8_t s_dy[4] = { 0, 1, 0, -1 };
+
+static uint8_t get_dir(const SnakeBody *b, int8_t x, int8_t y)
+{
+    return (uint8_t)((b->dir[DIR_BYTE(x, y)] >> DIR_SHIFT(x)) & 3);
+}
+
+static void set_dir(SnakeBody *b, int8_t x, int8_t y, uint8_t d)
+{
+    uint8_t *p = &b->dir[DIR_BYTE(x, y)];
+
+    *p = (uint8_t)((*p & ~(3u << DIR_SHIFT(x))) | (d << DIR_SHIFT(x)));
+}
+
+void Snake_bodyInit(SnakeBody *b)
+{
+    b->len = 0;
+    memset(b->occ, 0, sizeof(b->occ));
+    memset(b->row, 0, sizeof(b->row));
+}
+
+uint8_t Snake_bodyPush(SnakeBody *b, int8_t x, int8_t y)
+{
+    uint8_t d;
+
+    if (b->len == 0) {
+        b->tail_x = x;
+        b->tail_y = y;
+    } else {
+        // 舊的頭記錄往新的頭的方向
+        for (d = 0; d < 4; d++)
+            if (b->head_x + s_dx[d] == x && b->head_y + s_dy[d] == y) break;
+        if (d == 4) return 0;
+        set_dir(b, b->head_x, b->head_y, d);
+    }
+    b->head_x = x;
+    b->head_y = y;
+    b->occ[OCC_BYTE(x, y)] |= OCC_BIT(x);
+    b->row[(uint8_t)y]++;
+    b->len++;
+    return 1;
+}
+
+uint8_t Snake_bodyPop(SnakeBody *b, int8_t *x, int8_t *y)
+{
+    int8_t tx, ty;
+    uint8_t d;
+
+    if (b->len == 0) return 0;
+    tx = b->tail_x;
+    ty = b->tail_y;
+    b->occ[OCC_BYTE(tx, ty)] &= (uint8_t)~OCC_BIT(tx);
+    b->row[(uint8_t)ty]--;
+    if (x) *x = tx;
+    if (y) *y = ty;
+
+    // 尾巴沿方向碼移到下一節（只剩頭時方向碼無意義，len=0 後也不再使用）
+    d = get_dir(b, tx, ty);
+    b->tail_x = (int8_t)(tx + s_dx[d]);
+    b->tail_y = (int8_t)(ty + s_dy[d]);
+    b->len--;
+    return 1;
+}
+
+uint8_t Snake_bodyNext(const SnakeBody *b, int8_t *x, int8_t *y)
+{
+    uint8_t d;
+
+    if (*x == b->head_x && *y == b->head_y) return 0;
+    d = get_dir(b, *x, *y);
+    *x = (int8_t)(*x + s_dx[d]);
+    *y = (int8_t)(*y + s_dy[d]);
+    return 1;
+}
+
+void Snake_bodyAt(const SnakeBody *b, uint16_t i, int8_t *x, int8_t *y)
+{
+    *x = b->tail_x;
+    *y = b->tail_y;
+    while (i-- > 0 && Snake_bodyNext(b, x, y));
+}
+
+/*
+ * ================================================================
+ * 蛇身查詢函數
+ * 功能：讀取佔用表的一個位元；負的座標轉成無號數後也大於盤面
+ * ================================================================
+ */
+uint8_t Snake_bodyContains(const SnakeBody *b, int8_t x, int8_t y)
+{
+    if ((uint8_t)x >= SNAKE_GRID_W || (uint8_t)y >= SNAKE_GRID_H) return 0;
+    return (uint8_t)((b->occ[OCC_BYTE(x, y)] & OCC_BIT(x)) != 0);
+}
+
+/*
+ * ================================================================
+ * 隨機空格函數
+ * 功能：k = r % 空格數（唯一的一次除法），依序以每列空格數（64 - row[y]）
+ *       跳過整列，再以每個位元組的空格數跳過8格，最後在位元組內逐位元找到
+ *       第 k 個空格；步數有上限，與蛇身長度和盤面佔用比例無關
+ * ================================================================
+ */
+// 4位元的1的個數
+static const uint8_t s_nibble_bits[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+uint8_t Snake_bodyRandomFree(const SnakeBody *b, uint32_t r, int8_t *x, int8_t *y)
+{
+    uint16_t free_cells = (uint16_t)(SNAKE_GRID_W * SNAKE_GRID_H - b->len);
+    uint16_t k;
+    uint8_t gy, i, bit, empty, n;
+    const uint8_t *occ;
+
+    if (free_cells == 0) return 0;
+    k = (uint16_t)(r % free_cells);
+
+    // 找到第 k 個空格所在的列
+    for (gy = 0; gy < SNAKE_GRID_H; gy++) {
+        n = (uint8_t)(SNAKE_GRID_W - b->row[gy]);
+        if (k < n) break;
+        k -= n;
+    }
+
+    // 列中第 k 個空格所在的位元組（每個位元組8格）
+    occ = &b->occ[OCC_BYTE(0, gy)];
+    for (i = 0; i < SNAKE_GRID_W / 8; i++) {
+        empty = (uint8_t)~occ[i];
+        n = (uint8_t)(s_nibble_bits[empty & 0x0F] + s_nibble_bits[empty >> 4]);
+        if (k < n) break;
+        k -= n;
+    }
+
+    // 位元組中第 k 個0位元
+    empty = (uint8_t)~occ[i];
+    for (bit = 0; bit < 8; bit++) {
+        if (empty & (1u << bit)) {
+            if (k == 0) break;
+            k--;
+        }
+    }
+
+    *x = (int8_t)(i * 8 + bit);
+    *y = (int8_t)gy;
+    return 1;
+}
@@ -0,0 +1,105 @@
+/*
+ * ================================================================
+ * Snake_Body.h: 貪食蛇蛇身方向格子
+ * 功能：蛇身以64x32格子中每格2位元的「往頭方向的下一節」方向碼表示
+ *       （512位元組），只記錄頭與尾的座標，由尾巴沿方向碼走到頭；
+ *       每一步只寫入舊的頭的方向碼並沿尾巴的方向碼移動尾巴；
+ *       另以64x32位元的佔用表（256位元組）回答「某格是不是蛇身」，
+ *       並以每列的佔用數直接選出隨機的空格（放水果）
+ * 硬體：NUC100系列（Cortex-M0，無除法器：格子編號以位移與遮罩計算）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 原本的寫法（index 0 = 尾、len-1 = 頭）每一步把 len-1 個座標往前搬一格，
+ * 蛇越長越慢；現在每一步固定是一次 Snake_bodyPop() 加一次
+ * Snake_bodyPush()，吃到水果時不呼叫 Snake_bodyPop() 即可增長。
+ * 座標陣列每節2位元組，放得下整個盤面需4096位元組；方向碼固定512位元組，
+ * 任何長度（到2048節、整個盤面）都放得下。
+ * 佔用表在加入頭時設定、移除尾巴時清除，自身碰撞與水果位置檢查都是
+ * 一次位元測試，與蛇身長度無關（原本逐節比較）。
+ * 原本放水果是隨機選格子、是蛇身就重選，蛇越長重選越多次（沒有上限，
+ * 每次兩個 %）；Snake_bodyRandomFree() 把隨機數對應到第 k 個空格，
+ * 以每列佔用數跳過整列、再逐位元組找到該格，最多32列 + 8個位元組。
+ *
+ * 使用方式：
+ *   Snake_bodyInit(&body);
+ *   for (...) Snake_bodyPush(&body, x, y);       由尾到頭放入初始蛇身
+ *   每一步：if (!吃到水果) Snake_bodyPop(&body, &tx, &ty);   擦除 (tx, ty)
+ *           Snake_bodyPush(&body, new_x, new_y);             畫出新的頭
+ *   由尾到頭逐節：x = SNAKE_BODY_TAIL_X(&body); y = SNAKE_BODY_TAIL_Y(&body);
+ *                 do { ... } while (Snake_bodyNext(&body, &x, &y));
+ *   第 i 節（0 = 尾，由尾巴走 i 步）：Snake_bodyAt(&body, i, &x, &y);
+ *   (x, y) 是否為蛇身：Snake_bodyContains(&body, x, y);
+ *   隨機空格：Snake_bodyRandomFree(&body, rand(), &fx, &fy);
+ *
+ * 每一格最多只能有一節：加入新的頭之前先以 Snake_bodyContains() 檢查
+ * （自身碰撞即遊戲結束，遊戲規則本來就保證這一點）；新的頭必須與舊的頭
+ * 上下左右相鄰（方向碼只能表示這4個方向）。
+ */
+
+#ifndef __SNAKE_BODY_H__
+#define __SNAKE_BODY_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 參數設定
+// ================================================================
+// 盤面大小（格子數；每格2x2像素）：佔用表每列 SNAKE_GRID_W/8 個位元組，
+// 方向碼每列 SNAKE_GRID_W/4 個位元組
+#define SNAKE_GRID_W        64
+#define SNAKE_GRID_H        32
+#define SNAKE_GRID_CELLS    (SNAKE_GRID_W * SNAKE_GRID_H)
+#define SNAKE_GRID_BYTES    (SNAKE_GRID_CELLS / 8)
+
+// 蛇身最多的節數：整個盤面
+#define SNAKE_BODY_MAX      SNAKE_GRID_CELLS
+
+// 方向碼：從這一節往頭的方向到下一節
+#define SNAKE_DIR_RIGHT     0       // x + 1
+#define SNAKE_DIR_DOWN      1       // y + 1
+#define SNAKE_DIR_LEFT      2       // x - 1
+#define SNAKE_DIR_UP        3       // y - 1
+
+typedef struct {
+    int8_t head_x, head_y;      // 頭的格子座標（len=0 時無意義）
+    int8_t tail_x, tail_y;      // 尾巴的格子座標（len=0 時無意義）
+    uint16_t len;               // 節數
+    uint8_t dir[SNAKE_GRID_CELLS / 4];  // 方向碼：第 y 列第 x 格為 dir[y*16 + x/4] 的 bit (x%4)*2..+1
+    uint8_t occ[SNAKE_GRID_BYTES];  // 佔用表：第 y 列第 x 格為 occ[y*8 + x/8] 的 bit (x%8)
+    uint8_t row[SNAKE_GRID_H];      // 每列的佔用格數
+} SnakeBody;
+
+// 頭與尾巴的座標（len > 0 時）
+#define SNAKE_BODY_HEAD_X(b)    ((b)->head_x)
+#define SNAKE_BODY_HEAD_Y(b)    ((b)->head_y)
+#define SNAKE_BODY_TAIL_X(b)    ((b)->tail_x)
+#define SNAKE_BODY_TAIL_Y(b)    ((b)->tail_y)
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 清空蛇身與佔用表（方向碼只在蛇身的格子有意義，不需清除）
+void Snake_bodyInit(SnakeBody *b);
+
+// 在頭的前方加入一節（必須在盤面內、不是蛇身，且與舊的頭上下左右相鄰），
+// 回傳0表示不相鄰（未加入）
+uint8_t Snake_bodyPush(SnakeBody *b, int8_t x, int8_t y);
+
+// 移除尾巴並取得其座標（x/y可為NULL），回傳0表示蛇身是空的
+uint8_t Snake_bodyPop(SnakeBody *b, int8_t *x, int8_t *y);
+
+// (x, y) 是蛇身的一節時，改為往頭方向的下一節，回傳1；(x, y) 是頭時回傳0（不改變）
+uint8_t Snake_bodyNext(const SnakeBody *b, int8_t *x, int8_t *y);
+
+// 第 i 節的座標（0 = 尾，len-1 = 頭）：由尾巴走 i 步，逐節處理請改用 Snake_bodyNext()
+void Snake_bodyAt(const SnakeBody *b, uint16_t i, int8_t *x, int8_t *y);
+
+// 1=(x, y) 是蛇身的一節（佔用表的一個位元，O(1)）；盤面外的座標回傳0
+uint8_t Snake_bodyContains(const SnakeBody *b, int8_t x, int8_t y);
+
+// 以隨機數 r 選出一個空格（r % 空格數 決定第幾個空格，空格越多越接近均勻；
+// r 的範圍需遠大於 SNAKE_GRID_CELLS，例如 rand()），回傳0表示盤面已滿
+uint8_t Snake_bodyRandomFree(const SnakeBody *b, uint32_t r, int8_t *x, int8_t *y);
+
+#endif
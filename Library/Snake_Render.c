@@ -0,0 +1,136 @@
+/*
+ * ================================================================
+ * Snake_Render.c: 貪食蛇格子的增量繪製
+ * 功能：記錄改變的格子，依page與column排序後合併成區段，
+ *       每段設定一次位址並送出由佔用表算出的page位元組
+ * 硬體：Nu-LB-NUC140開發板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <stdio.h>
+#include "NUC100Series.h"
+#include "LCD.h"
+#include "Snake_Render.h"
+
+// ---------------- 外部函式宣告 ----------------
+// 由LCD.c提供：設定位址（page、column）與寫入一個資料位元組，
+// 寫入後控制器的column位址自動加1
+extern void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+extern void lcdWriteData(unsigned char temp);
+
+// 畫面左右鏡像（與 LCD_Shadow.c 相同）：x 對應控制器column (129 - x)，
+// 區段由右往左送出
+#define LCD_COLUMN(x)   (LCD_SHADOW_WIDTH + 1 - (x))
+
+// 每個page有4列格子
+#define CELL_ROWS       (8 / 2)
+
+// ---------------- 記錄的格子 ----------------
+static uint8_t s_page[SNAKE_RENDER_CELLS];
+static uint8_t s_gx[SNAKE_RENDER_CELLS];
+static uint8_t s_count;
+static uint8_t s_overflow;          // 1=記錄放不下，下一次送出整個畫面
+
+// 第 page 頁、第 gx 格的column位元組（gx*2 與 gx*2+1 兩個column相同）
+static uint8_t cell_byte(const SnakeBody *b, int8_t fruit_x, int8_t fruit_y, uint8_t page, uint8_t gx)
+{
+    uint8_t r, value = 0;
+    int8_t gy = (int8_t)(page * CELL_ROWS);
+
+    for (r = 0; r < CELL_ROWS; r++, gy++)
+        if (Snake_bodyContains(b, (int8_t)gx, gy) || (gx == fruit_x && gy == fruit_y))
+            value |= (uint8_t)(0x03 << (r * 2));
+    return value;
+}
+
+uint16_t Snake_renderAll(const SnakeBody *b, int8_t fruit_x, int8_t fruit_y)
+{
+    uint8_t page, gx, value;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        lcdSetAddr(page, LCD_COLUMN(LCD_SHADOW_WIDTH - 1));
+        for (gx = SNAKE_GRID_W; gx-- > 0;) {
+            value = cell_byte(b, fruit_x, fruit_y, page, gx);
+            lcdWriteData(value);
+            lcdWriteData(value);
+        }
+    }
+    s_count = 0;
+    s_overflow = 0;
+    return LCD_SHADOW_PAGES * (LCD_SHADOW_ADDR_BYTES + LCD_SHADOW_WIDTH);
+}
+
+void Snake_renderCell(int8_t gx, int8_t gy)
+{
+    uint8_t i, page;
+
+    if (gx < 0 || gx >= SNAKE_GRID_W || gy < 0 || gy >= SNAKE_GRID_H) return;
+    if (s_overflow) return;
+
+    // 同一個位元組只記錄一次（同一格，或同一個page上下相鄰的格子）
+    page = (uint8_t)gy / CELL_ROWS;
+    for (i = 0; i < s_count; i++)
+        if (s_page[i] == page && s_gx[i] == (uint8_t)gx) return;
+    if (s_count >= SNAKE_RENDER_CELLS) {
+        s_overflow = 1;
+        return;
+    }
+
+    // 依 (page, gx) 插入排序
+    for (i = s_count; i > 0; i--) {
+        if (s_page[i - 1] < page || (s_page[i - 1] == page && s_gx[i - 1] < (uint8_t)gx)) break;
+        s_page[i] = s_page[i - 1];
+        s_gx[i] = s_gx[i - 1];
+    }
+    s_page[i] = page;
+    s_gx[i] = (uint8_t)gx;
+    s_count++;
+}
+
+uint16_t Snake_renderFlush(const SnakeBody *b, int8_t fruit_x, int8_t fruit_y, LcdShadowStats *stats)
+{
+    uint8_t i, j, page, lo, hi, gx, value;
+    uint16_t data = 0, cmd = 0;
+    uint8_t spans = 0;
+
+    if (s_overflow) {
+        data = Snake_renderAll(b, fruit_x, fruit_y);
+        if (stats) {
+            stats->cmd = LCD_SHADOW_PAGES * LCD_SHADOW_ADDR_BYTES;
+            stats->data = data - stats->cmd;
+            stats->spans = LCD_SHADOW_PAGES;
+        }
+        return data;
+    }
+
+    for (i = 0; i < s_count; i = j) {
+        // 同一個page中只隔一格的格子合併：多送中間2個不變的位元組，
+        // 少於另設一次位址的3個命令
+        page = s_page[i];
+        lo = s_gx[i];
+        hi = lo;
+        for (j = i + 1; j < s_count && s_page[j] == page &&
+             (s_gx[j] - hi - 1) * 2 <= LCD_SHADOW_ADDR_BYTES; j++)
+            hi = s_gx[j];
+
+        // 位址自動加1是 x 遞減的方向：從右端的column開始送出
+        lcdSetAddr(page, LCD_COLUMN(hi * 2 + 1));
+        for (gx = (uint8_t)(hi + 1); gx-- > lo;) {
+            value = cell_byte(b, fruit_x, fruit_y, page, gx);
+            lcdWriteData(value);
+            lcdWriteData(value);
+        }
+        data += (uint16_t)((hi - lo + 1) * 2);
+        cmd += LCD_SHADOW_ADDR_BYTES;
+        spans++;
+    }
+    s_count = 0;
+
+    if (stats) {
+        stats->data = data;
+        stats->cmd = cmd;
+        stats->spans = spans;
+    }
+    return (uint16_t)(data + cmd);
+}
@@ -0,0 +1,63 @@
+/*
+ * ================================================================
+ * Snake_Render.h: 貪食蛇格子的增量繪製
+ * 功能：每一步只記錄改變的格子（新的頭、移除的尾巴、水果），
+ *       送出時把同一個page相鄰的格子合併成一段，page位元組直接由
+ *       蛇身佔用表與水果位置算出，不需要影子緩衝區
+ * 硬體：NUC100系列 + 128x64 LCD（LCD.c 的 lcdSetAddr/lcdWriteData）
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 每格2x2像素：格子 (gx, gy) 是第 gy/4 頁、x = gx*2 與 gx*2+1 兩個column
+ * 位元組中的 bit (gy%4)*2 與 (gy%4)*2+1；同一個位元組的其他6個位元是上下
+ * 相鄰的3個格子，由 Snake_bodyContains() 查出，因此送出的內容永遠與蛇身
+ * 一致，不需要逐節重畫來修補被擦掉的格子。
+ *
+ * 傳輸成本（SPI3位元組）：
+ * - 原本（Lab-9/Q2-final.c）每一步逐節重畫整條蛇到影子緩衝區（CPU時間與
+ *   長度成正比），影子緩衝區每個page只記錄一段範圍，頭與尾在同一個page時
+ *   連中間的column一起送出，最多128個資料位元組
+ * - Snake_renderFlush()：每段3個位址命令 + 2個資料位元組/格，同一個page
+ *   相鄰或只隔一格的格子合併成一段；一般移動（頭 + 尾）最多10位元組，
+ *   與蛇身長度無關
+ *
+ * 使用方式：
+ *   init_LCD(); Snake_renderAll(&body, fruit_x, fruit_y);     整個畫面
+ *   每一步：Snake_bodyPop()/Snake_bodyPush() 之後
+ *           Snake_renderCell(tail_x, tail_y); Snake_renderCell(new_x, new_y);
+ *           水果移動時 Snake_renderCell() 舊位置與新位置
+ *           Snake_renderFlush(&body, fruit_x, fruit_y, NULL);
+ *
+ * 畫面上只有蛇與水果：其他程式直接畫到LCD之後需 Snake_renderAll()。
+ */
+
+#ifndef __SNAKE_RENDER_H__
+#define __SNAKE_RENDER_H__
+
+#include <stdint.h>
+#include "LCD_Shadow.h"
+#include "Snake_Body.h"
+
+// ================================================================
+// 參數設定
+// ================================================================
+// 每次送出之前最多記錄的格子數（一般移動2格；吃到水果時頭、尾、新水果3格），
+// 超過時下一次 Snake_renderFlush() 改為整個畫面重送
+#ifndef SNAKE_RENDER_CELLS
+#define SNAKE_RENDER_CELLS  4
+#endif
+
+// ================================================================
+// 函數宣告
+// ================================================================
+// 依蛇身與水果送出整個畫面（取代 clear_LCD() 加逐格繪製），清除記錄的格子，
+// 回傳SPI3傳送的位元組數；沒有水果時 fruit_x/fruit_y 為 -1
+uint16_t Snake_renderAll(const SnakeBody *b, int8_t fruit_x, int8_t fruit_y);
+
+// 記錄改變的格子（畫或擦都一樣，送出時才依蛇身與水果決定內容）；盤面外忽略
+void Snake_renderCell(int8_t gx, int8_t gy);
+
+// 送出記錄的格子並清除記錄，回傳SPI3傳送的位元組數（stats可為NULL）
+uint16_t Snake_renderFlush(const SnakeBody *b, int8_t fruit_x, int8_t fruit_y, LcdShadowStats *stats);
+
+#endif
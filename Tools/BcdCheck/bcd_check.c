@@ -0,0 +1,301 @@
+/*
+ * ================================================================
+ * bcd_check.c: BCD計數器正確性檢查與效能比較（Linux主機端）
+ * 功能：以 / 與 % 算出的位數為參考，檢查 Library/BCD_Counter.c 的
+ *       BCD_increment()、BCD_add()、BCD_fromBinary()、BCD_DIGIT()、
+ *       BCD_width() 在0-9999的結果；並比較Lab 10 計時中斷、Lab 9 加分
+ *       原本的除法拆位數與BCD寫法每次的時間與週期數
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 除法寫法分兩種計時：
+ * - 常數除數：主機的gcc把 /10、/100 換成乘法，Cortex-M0 沒有
+ *   32x32→64 乘法，仍會呼叫函式庫除法，因此這一欄低估了原本的成本
+ * - 執行期除數：除數從volatile讀出，主機使用硬體除法指令，
+ *   比較接近每次 / 或 % 都是一次函式呼叫的情況
+ * 另外列出每次操作的 / 與 % 次數，Cortex-M0 上每一次都是一次
+ * __aeabi_uidiv / __aeabi_uidivmod 呼叫。
+ *
+ * 週期數是主機的時間戳記計數器（x86 rdtsc），只用來比較同一台主機上的
+ * 不同寫法；其他平台只列出奈秒。
+ *
+ * 用法：bcdcheck [-t 每項測試毫秒數]
+ * 回傳值：任何結果與 / % 參考不同時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "BCD_Counter.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC    1
+#else
+#define HAVE_TSC    0
+#endif
+
+#define BATCH           1000
+
+// ================================================================
+// 參考：以 / 與 % 取位數
+// ================================================================
+static uint16_t ref_bcd(uint32_t v)
+{
+    return (uint16_t)(((v / 1000) % 10) << 12 | ((v / 100) % 10) << 8 |
+                      ((v / 10) % 10) << 4 | (v % 10));
+}
+
+// ================================================================
+// 正確性檢查
+// ================================================================
+static unsigned long check(void)
+{
+    unsigned long errors = 0;
+    uint32_t v, w;
+    uint16_t bcd, a;
+    uint8_t n, width;
+
+    for (v = 0; v <= 9999; v++) {
+        bcd = ref_bcd(v);
+
+        if (BCD_fromBinary((uint16_t)v) != bcd) {
+            if (errors++ < 10) printf("  BCD_fromBinary(%u) = %04X\n", v, BCD_fromBinary((uint16_t)v));
+        }
+        if (BCD_increment(bcd) != ref_bcd((v + 1) % 10000)) {
+            if (errors++ < 10) printf("  BCD_increment(%04X) = %04X\n", bcd, BCD_increment(bcd));
+        }
+        for (n = 0; n < 4; n++) {
+            w = v;
+            if (n >= 1) w /= 10;
+            if (n >= 2) w /= 10;
+            if (n >= 3) w /= 10;
+            if (BCD_DIGIT(bcd, n) != w % 10) {
+                if (errors++ < 10) printf("  BCD_DIGIT(%04X, %u) = %u\n", bcd, n, BCD_DIGIT(bcd, n));
+            }
+        }
+        width = v >= 1000 ? 4 : v >= 100 ? 3 : v >= 10 ? 2 : 1;
+        if (BCD_width(bcd) != width) {
+            if (errors++ < 10) printf("  BCD_width(%04X) = %u\n", bcd, BCD_width(bcd));
+        }
+
+        // 所有 (a, b) 組合，超過9999捨去進位
+        for (w = 0; w <= 9999; w++) {
+            a = BCD_add(bcd, ref_bcd(w));
+            if (a != ref_bcd((v + w) % 10000)) {
+                if (errors++ < 10) printf("  BCD_add(%04X, %04X) = %04X\n", bcd, ref_bcd(w), a);
+            }
+        }
+    }
+
+    // 超過9999：轉換結果為9999
+    for (v = 10000; v <= 0xFFFF; v++) {
+        if (BCD_fromBinary((uint16_t)v) != BCD_MAX) {
+            if (errors++ < 10) printf("  BCD_fromBinary(%u) = %04X\n", v, BCD_fromBinary((uint16_t)v));
+        }
+    }
+    return errors;
+}
+
+// ================================================================
+// 比較的寫法
+// ================================================================
+static volatile uint32_t s_ten = 10, s_hundred = 100, s_thousand = 1000;   // 執行期除數
+static volatile uint8_t s_digit[4];
+
+// Lab 10 原本的TMR0（常數除數）：每10ms計數一次，再拆成4個位數
+static uint32_t s_counter;
+static void __attribute__((noinline)) tick_div_const(void)
+{
+    uint32_t total_seconds;
+
+    s_counter++;
+    total_seconds = s_counter / 100;
+    s_digit[0] = total_seconds % 10;
+    s_digit[1] = (total_seconds / 10) % 10;
+    s_digit[2] = (total_seconds / 100) % 10;
+    s_digit[3] = (total_seconds / 1000) % 10;
+}
+
+// 同上，除數從volatile讀出（每個 / 與 % 都是一次除法）
+static void __attribute__((noinline)) tick_div_runtime(void)
+{
+    uint32_t total_seconds;
+
+    s_counter++;
+    total_seconds = s_counter / s_hundred;
+    s_digit[0] = total_seconds % s_ten;
+    s_digit[1] = (total_seconds / s_ten) % s_ten;
+    s_digit[2] = (total_seconds / s_hundred) % s_ten;
+    s_digit[3] = (total_seconds / s_thousand) % s_ten;
+}
+
+// Lab 10 目前的TMR0：0.01秒計數器滿100才進位到BCD秒數
+static uint8_t s_centi;
+static uint16_t s_bcd;
+static void __attribute__((noinline)) tick_bcd(void)
+{
+    s_centi++;
+    if (s_centi >= 100) {
+        s_centi = 0;
+        s_bcd = BCD_increment(s_bcd);
+        s_digit[0] = BCD_DIGIT(s_bcd, 0);
+        s_digit[1] = BCD_DIGIT(s_bcd, 1);
+        s_digit[2] = BCD_DIGIT(s_bcd, 2);
+        s_digit[3] = BCD_DIGIT(s_bcd, 3);
+    }
+}
+
+// 同上，每次都是進位的那一個tick（中斷的最長執行時間）
+static void __attribute__((noinline)) tick_bcd_rollover(void)
+{
+    s_bcd = BCD_increment(s_bcd);
+    s_digit[0] = BCD_DIGIT(s_bcd, 0);
+    s_digit[1] = BCD_DIGIT(s_bcd, 1);
+    s_digit[2] = BCD_DIGIT(s_bcd, 2);
+    s_digit[3] = BCD_DIGIT(s_bcd, 3);
+}
+
+// Lab 9 原本的加分：score += 10 之後拆成4個位數
+static uint32_t s_score;
+static void __attribute__((noinline)) score_div_const(void)
+{
+    s_score = (s_score + 10) % 10000;
+    s_digit[0] = s_score % 10;
+    s_digit[1] = (s_score / 10) % 10;
+    s_digit[2] = (s_score / 100) % 10;
+    s_digit[3] = (s_score / 1000) % 10;
+}
+
+static void __attribute__((noinline)) score_div_runtime(void)
+{
+    s_score = (s_score + s_ten) % (s_thousand * s_ten);
+    s_digit[0] = s_score % s_ten;
+    s_digit[1] = (s_score / s_ten) % s_ten;
+    s_digit[2] = (s_score / s_hundred) % s_ten;
+    s_digit[3] = (s_score / s_thousand) % s_ten;
+}
+
+static void __attribute__((noinline)) score_bcd(void)
+{
+    s_bcd = BCD_add(s_bcd, 0x0010);
+    s_digit[0] = BCD_DIGIT(s_bcd, 0);
+    s_digit[1] = BCD_DIGIT(s_bcd, 1);
+    s_digit[2] = BCD_DIGIT(s_bcd, 2);
+    s_digit[3] = BCD_DIGIT(s_bcd, 3);
+}
+
+// 二進位轉換（只在初始化時使用）
+static volatile uint16_t s_value;
+static void __attribute__((noinline)) conv_div_runtime(void)
+{
+    uint32_t v = s_value;
+
+    s_bcd = (uint16_t)(((v / s_thousand) % s_ten) << 12 | ((v / s_hundred) % s_ten) << 8 |
+                       ((v / s_ten) % s_ten) << 4 | (v % s_ten));
+    s_value = v >= 9999 ? 0 : (uint16_t)(v + 1);
+}
+
+static void __attribute__((noinline)) conv_bcd(void)
+{
+    uint16_t v = s_value;
+
+    s_bcd = BCD_fromBinary(v);
+    s_value = v >= 9999 ? 0 : (uint16_t)(v + 1);
+}
+
+// ================================================================
+// 效能測試
+// ================================================================
+typedef struct {
+    const char *name;
+    void (*op)(void);
+    unsigned int divides;       // 每次操作的 / 與 % 次數（Cortex-M0 的函式庫除法呼叫）
+} Case;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void reset_state(void)
+{
+    s_counter = 0;
+    s_centi = 0;
+    s_bcd = 0;
+    s_score = 0;
+    s_value = 0;
+}
+
+// 每次操作的奈秒數與主機週期數
+static void bench(const Case *c, double run_ns)
+{
+    unsigned long ops = 0;
+    double start, elapsed;
+    uint64_t t0 = 0, t1 = 0;
+    int k;
+
+    reset_state();
+    start = now_ns();
+#if HAVE_TSC
+    t0 = __rdtsc();
+#endif
+    do {
+        for (k = 0; k < BATCH; k++) c->op();
+        ops += BATCH;
+        elapsed = now_ns() - start;
+    } while (elapsed < run_ns);
+#if HAVE_TSC
+    t1 = __rdtsc();
+#endif
+
+    printf("  %-22s %8.2f ns", c->name, elapsed / ops);
+    if (HAVE_TSC) printf(" %8.1f cycles", (double)(t1 - t0) / ops);
+    printf("   %u divides/op\n", c->divides);
+}
+
+int main(int argc, char **argv)
+{
+    static const Case tick[] = {
+        { "/,% const divisor",   tick_div_const,    8 },
+        { "/,% runtime divisor", tick_div_runtime,  8 },
+        { "BCD_increment",       tick_bcd,          0 },
+        { "BCD rollover tick",   tick_bcd_rollover, 0 },
+    };
+    static const Case score[] = {
+        { "/,% const divisor",   score_div_const,   9 },
+        { "/,% runtime divisor", score_div_runtime, 9 },
+        { "BCD_add",             score_bcd,         0 },
+    };
+    static const Case conv[] = {
+        { "/,% runtime divisor", conv_div_runtime, 7 },
+        { "BCD_fromBinary",      conv_bcd,         0 },
+    };
+    double run_ns = 200e6;
+    unsigned long errors;
+    unsigned int i;
+
+    if (argc == 3 && !strcmp(argv[1], "-t")) {
+        run_ns = atof(argv[2]) * 1e6;
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [-t ms]\n", argv[0]);
+        return 2;
+    }
+
+    errors = check();
+    printf("check: %s (increment, fromBinary, DIGIT, width over 0-9999; add over all 10000x10000 pairs)\n",
+           errors ? "FAIL" : "ok");
+
+    printf("\nLab 10 TMR0 tick (every 10 ms; digits recomputed every tick / on rollover):\n");
+    for (i = 0; i < sizeof(tick) / sizeof(tick[0]); i++) bench(&tick[i], run_ns);
+    printf("\nLab 9 score +10 and split into digits:\n");
+    for (i = 0; i < sizeof(score) / sizeof(score[0]); i++) bench(&score[i], run_ns);
+    printf("\nbinary -> 4 digits (init only):\n");
+    for (i = 0; i < sizeof(conv) / sizeof(conv[0]); i++) bench(&conv[i], run_ns);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,389 @@
+/*
+ * ================================================================
+ * bmp2lcd.c: BMP轉LCD點陣圖陣列（Linux主機端）
+ * 功能：讀取1/8/24-bpp BMP，以門檻值或Floyd-Steinberg抖動轉為單色，
+ *       輸出 draw_Bmp64x64()/draw_LCD() 使用的page順序C陣列，
+ *       可選擇 Library/LCD_Rle.h 格式的RLE壓縮版本
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：bmp2lcd [-t 門檻值] [-d] [-i] [-r] [-n 名稱] [-o 輸出] 檔案.bmp ...
+ *       bmp2lcd -c [次數]
+ *   -t  亮度低於門檻值（0-255，預設128）的像素點亮
+ *   -d  以Floyd-Steinberg抖動取代門檻值（灰階/彩色圖）
+ *   -i  反相（亮的像素點亮）
+ *   -r  輸出RLE壓縮陣列（名稱加 _rle），並以韌體的 LCD_Rle.c 解碼驗證
+ *   -n  陣列名稱（只有一個檔案時），預設為檔名（非英數字元改為底線）
+ *   -o  輸出檔，預設為標準輸出（.h 檔加上 include guard）
+ *   -c  RLE自我檢查：隨機產生的點陣圖（預設200000個，寬1-128、1-8頁，
+ *       混合重複段、照抄段與剛好在段長上下限的長度）編碼後以 LCD_Rle.c
+ *       解碼比對，並確認壓縮後不超過 MAX_RLE
+ * 高度不是8的倍數時，最後一頁不足的列補0。
+ * 回傳值：檔案無法讀取、格式不支援或RLE驗證失敗時不為0
+ *         （-c：任何一個點陣圖解碼結果不同時為1）
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "LCD.h"
+#include "LCD_Shadow.h"
+#include "LCD_Rle.h"
+
+#define MAX_W           LCD_SHADOW_WIDTH
+#define MAX_H           LCD_SHADOW_HEIGHT
+#define MAX_BYTES       (MAX_W * MAX_H / 8)
+#define MAX_RLE         (MAX_BYTES + MAX_BYTES / LCD_RLE_MAX_LITERAL + 1)
+
+// 影子緩衝區的SPI3輸出（只用於連結，驗證時不送出）
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr) { (void)PageAddr; (void)ColumnAddr; }
+void lcdWriteData(unsigned char temp) { (void)temp; }
+
+typedef struct {
+    int threshold;
+    int dither;
+    int invert;
+    int rle;
+} Options;
+
+typedef struct {
+    int w, h, bpp;
+    uint8_t lum[MAX_H][MAX_W];          // 亮度0-255，由上而下、由左而右
+} Image;
+
+/*
+ * ================================================================
+ * 讀取BMP
+ * ================================================================
+ */
+static uint32_t le16(const uint8_t *p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8); }
+static uint32_t le32(const uint8_t *p) { return le16(p) | (le16(p + 2) << 16); }
+
+static int luma(int r, int g, int b)
+{
+    return (r * 299 + g * 587 + b * 114) / 1000;
+}
+
+// 回傳NULL表示成功，否則為錯誤說明
+static const char *parse_bmp(const uint8_t *d, long size, Image *img)
+{
+    uint32_t off, hdr, colors, stride, i;
+    int32_t height;
+    int x, y, row, top_down, v;
+    uint8_t pal[256];
+    const uint8_t *line, *c;
+
+    if (size < 54 || d[0] != 'B' || d[1] != 'M') return "not a BMP file";
+
+    off = le32(d + 10);
+    hdr = le32(d + 14);
+    img->w = (int32_t)le32(d + 18);
+    height = (int32_t)le32(d + 22);
+    img->bpp = (int)le16(d + 28);
+    top_down = height < 0;
+    img->h = top_down ? -height : height;
+
+    if (hdr < 40 || le32(d + 30) != 0) return "only uncompressed BMPs are supported";
+    if (img->bpp != 1 && img->bpp != 8 && img->bpp != 24) return "only 1, 8 and 24-bpp BMPs are supported";
+    if (img->w < 1 || img->w > MAX_W || img->h < 1 || img->h > MAX_H) return "larger than the 128x64 LCD";
+
+    // 調色盤（1/8-bpp）：先換算成亮度
+    memset(pal, 0, sizeof(pal));
+    if (img->bpp != 24) {
+        colors = le32(d + 46);
+        if (colors == 0 || colors > (1u << img->bpp)) colors = 1u << img->bpp;
+        if (14 + hdr + colors * 4 > (uint32_t)size) return "truncated palette";
+        for (i = 0; i < colors; i++) {
+            c = d + 14 + hdr + i * 4;                   // B, G, R, 0
+            pal[i] = (uint8_t)luma(c[2], c[1], c[0]);
+        }
+    }
+
+    stride = ((uint32_t)img->w * (uint32_t)img->bpp + 31) / 32 * 4;
+    if (off + stride * (uint32_t)img->h > (uint32_t)size) return "truncated pixel data";
+
+    for (y = 0; y < img->h; y++) {
+        row = top_down ? y : img->h - 1 - y;            // BMP預設由下而上存放
+        line = d + off + stride * (uint32_t)row;
+        for (x = 0; x < img->w; x++) {
+            if (img->bpp == 1) v = pal[(line[x >> 3] >> (7 - (x & 7))) & 1];
+            else if (img->bpp == 8) v = pal[line[x]];
+            else v = luma(line[x * 3 + 2], line[x * 3 + 1], line[x * 3]);
+            img->lum[y][x] = (uint8_t)v;
+        }
+    }
+    return NULL;
+}
+
+static int read_bmp(const char *path, Image *img)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *d;
+    long size;
+    const char *err = "cannot read file";
+
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    d = malloc((size_t)size + 1);
+    if (d && fread(d, 1, (size_t)size, f) == (size_t)size) err = parse_bmp(d, size, img);
+    free(d);
+    fclose(f);
+
+    if (err) fprintf(stderr, "%s: %s\n", path, err);
+    return err != NULL;
+}
+
+/*
+ * ================================================================
+ * 轉為單色並排成page順序：out[page*w + x] 的 bit n 為第 page*8+n 列
+ * ================================================================
+ */
+static int convert(Image *img, const Options *o, uint8_t *out)
+{
+    static int err[MAX_H + 1][MAX_W + 2];        // 抖動誤差（x位移1，左右各留一格）
+    int x, y, v, on, e, pages = (img->h + 7) / 8;
+
+    memset(out, 0, (size_t)(pages * img->w));
+    memset(err, 0, sizeof(err));
+
+    for (y = 0; y < img->h; y++) {
+        for (x = 0; x < img->w; x++) {
+            v = img->lum[y][x];
+            if (o->dither) {
+                v += err[y][x + 1] / 16;
+                on = v < 128;
+                e = v - (on ? 0 : 255);
+                err[y][x + 2] += e * 7;
+                err[y + 1][x] += e * 3;
+                err[y + 1][x + 1] += e * 5;
+                err[y + 1][x + 2] += e * 1;
+            } else {
+                on = v < o->threshold;
+            }
+            if (o->invert) on = !on;
+            if (on) out[(y >> 3) * img->w + x] |= (uint8_t)(1 << (y & 7));
+        }
+    }
+    return pages * img->w;
+}
+
+/*
+ * ================================================================
+ * RLE編碼（格式見 Library/LCD_Rle.h）
+ * ================================================================
+ */
+static int rle_encode(const uint8_t *in, int n, uint8_t *out)
+{
+    int i = 0, size = 0, run, lit;
+
+    while (i < n) {
+        for (run = 1; i + run < n && in[i + run] == in[i] && run < LCD_RLE_MAX_REPEAT; run++) { }
+        if (run >= LCD_RLE_MIN_REPEAT) {
+            out[size++] = (uint8_t)(LCD_RLE_REPEAT | (run - LCD_RLE_MIN_REPEAT));
+            out[size++] = in[i];
+            i += run;
+            continue;
+        }
+
+        // 照抄段：直到出現3個以上相同的位元組
+        for (lit = 0; i + lit < n && lit < LCD_RLE_MAX_LITERAL; lit++) {
+            if (i + lit + 2 < n && in[i + lit] == in[i + lit + 1] && in[i + lit] == in[i + lit + 2]) break;
+        }
+        out[size++] = (uint8_t)(lit - 1);
+        memcpy(&out[size], &in[i], (size_t)lit);
+        size += lit;
+        i += lit;
+    }
+    return size;
+}
+
+// 以韌體的解碼器解回來（串流讀取 + 寫入影子緩衝區兩種方式）並比對
+static int rle_verify(const uint8_t *raw, const uint8_t *rle, int size, int w, int pages)
+{
+    LcdRleReader r;
+    int i, p, x;
+
+    LCD_rleBegin(&r, rle);
+    for (i = 0; i < w * pages; i++) {
+        if (LCD_rleNext(&r) != raw[i]) return 1;
+    }
+    if (r.src != rle + size || r.count != 0) return 1;
+
+    LCD_shadowInit();
+    LCD_rleDraw(0, 0, rle, (uint8_t)w, (uint8_t)pages);
+    for (p = 0; p < pages; p++) {
+        for (x = 0; x < w; x++) {
+            if (LCD_shadowRead((uint8_t)p, (uint8_t)x) != raw[p * w + x]) return 1;
+        }
+    }
+    return 0;
+}
+
+// 隨機點陣圖：重複段、照抄段與剛好在段長上下限的長度交錯
+static int random_bitmap(uint8_t *raw, int *w, int *pages)
+{
+    static const int edge[] = { 1, 2, 3, 4, LCD_RLE_MAX_LITERAL - 1, LCD_RLE_MAX_LITERAL,
+                                LCD_RLE_MAX_LITERAL + 1, LCD_RLE_MAX_REPEAT - 1,
+                                LCD_RLE_MAX_REPEAT, LCD_RLE_MAX_REPEAT + 1 };
+    int n, i = 0, len, kind, k;
+    uint8_t b;
+
+    *w = 1 + rand() % MAX_W;
+    *pages = 1 + rand() % (MAX_H / 8);
+    n = *w * *pages;
+    while (i < n) {
+        len = (rand() % 4) ? 1 + rand() % 140 : edge[rand() % (int)(sizeof(edge) / sizeof(edge[0]))];
+        kind = rand() % 3;
+        b = (uint8_t)rand();
+        for (k = 0; k < len && i < n; k++, i++) {
+            switch (kind) {
+            case 0:  raw[i] = b; break;                                 // 重複段
+            case 1:  raw[i] = (uint8_t)(b + k); break;                  // 照抄段（沒有相鄰相同）
+            default: raw[i] = (uint8_t)(k % 3 == 2 ? b ^ 1 : b); break; // 兩個相同後斷開
+            }
+        }
+    }
+    return n;
+}
+
+static int self_check(long count)
+{
+    static uint8_t raw[MAX_BYTES], rle[MAX_RLE];
+    long k, errors = 0, in = 0, out = 0;
+    int n, size, w, pages;
+
+    srand(1);
+    for (k = 0; k < count; k++) {
+        n = random_bitmap(raw, &w, &pages);
+        size = rle_encode(raw, n, rle);
+        in += n;
+        out += size;
+        if (size > MAX_RLE || rle_verify(raw, rle, size, w, pages)) {
+            if (errors++ < 10) printf("  bitmap %ld (%dx%d pages): RLE %d bytes, round trip failed\n", k, w, pages, size);
+        }
+    }
+    printf("RLE round trip: %s (%ld random bitmaps, %ld -> %ld bytes; LCD_rleNext and LCD_rleDraw)\n",
+           errors ? "FAIL" : "ok", count, in, out);
+    return errors ? 1 : 0;
+}
+
+/*
+ * ================================================================
+ * 輸出
+ * ================================================================
+ */
+static void write_array(FILE *f, const char *name, const uint8_t *d, int n)
+{
+    int i;
+
+    fprintf(f, "const unsigned char %s[%d] = {\n", name, n);
+    for (i = 0; i < n; i++) {
+        fprintf(f, "%s0x%02X%s", (i % 16) ? " " : "    ", d[i], (i < n - 1) ? "," : "");
+        if (i % 16 == 15 || i == n - 1) fprintf(f, "\n");
+    }
+    fprintf(f, "};\n");
+}
+
+static void default_name(const char *path, char *name, size_t size)
+{
+    const char *base = strrchr(path, '/');
+    size_t i;
+
+    base = base ? base + 1 : path;
+    for (i = 0; base[i] && base[i] != '.' && i < size - 1; i++) {
+        name[i] = isalnum((unsigned char)base[i]) ? base[i] : '_';
+    }
+    name[i] = '\0';
+}
+
+static int convert_file(FILE *f, const char *path, const char *name, const Options *o)
+{
+    static Image img;
+    static uint8_t raw[MAX_BYTES], rle[MAX_RLE];
+    char rle_name[80];
+    const char *base = strrchr(path, '/');
+    int n, size, pages;
+
+    if (read_bmp(path, &img)) return 1;
+    n = convert(&img, o, raw);
+    pages = (img.h + 7) / 8;
+    base = base ? base + 1 : path;
+
+    fprintf(f, "\n// %s: %dx%d，%d-bpp，%s%s，%d頁x%d位元組\n", base, img.w, img.h, img.bpp,
+            o->dither ? "抖動" : "門檻值", o->invert ? "（反相）" : "", pages, img.w);
+    if (!o->rle) {
+        write_array(f, name, raw, n);
+        return 0;
+    }
+
+    size = rle_encode(raw, n, rle);
+    if (rle_verify(raw, rle, size, img.w, pages)) {
+        fprintf(stderr, "%s: RLE round trip through LCD_Rle.c failed\n", path);
+        return 1;
+    }
+    fprintf(f, "// RLE：%d -> %d 位元組，以 LCD_rleDraw(x, page, %s_rle, %d, %d) 繪製\n",
+            n, size, name, img.w, pages);
+    snprintf(rle_name, sizeof(rle_name), "%s_rle", name);
+    write_array(f, rle_name, rle, size);
+    fprintf(stderr, "%s: %d bytes, RLE %d bytes (%.0f%%)\n", base, n, size, 100.0 * size / n);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    Options o = { 128, 0, 0, 0 };
+    const char *out = NULL, *name = NULL;
+    char auto_name[64], guard[64] = "";
+    FILE *f = stdout;
+    int i, k, err = 0;
+
+    if (argc >= 2 && !strcmp(argv[1], "-c")) return self_check(argc > 2 ? atol(argv[2]) : 200000);
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (!strcmp(argv[i], "-d")) o.dither = 1;
+        else if (!strcmp(argv[i], "-i")) o.invert = 1;
+        else if (!strcmp(argv[i], "-r")) o.rle = 1;
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc) o.threshold = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) out = argv[++i];
+        else break;
+    }
+    if (i >= argc || (i < argc && argv[i][0] == '-') || (name && argc - i != 1) ||
+        o.threshold < 0 || o.threshold > 256) {
+        fprintf(stderr, "usage: %s [-t threshold] [-d] [-i] [-r] [-n name] [-o out] file.bmp ...\n"
+                        "       %s -c [count]\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    if (out && (f = fopen(out, "w")) == NULL) {
+        fprintf(stderr, "cannot write %s\n", out);
+        return 2;
+    }
+
+    fprintf(f, "// 由 Tools/Bmp2Lcd 產生，請勿手動修改：\n//   bmp2lcd");
+    for (k = 1; k < argc; k++) fprintf(f, " %s", argv[k]);
+    fprintf(f, "\n");
+
+    k = out ? (int)strlen(out) : 0;
+    if (k > 2 && !strcmp(out + k - 2, ".h")) {
+        default_name(out, auto_name, sizeof(auto_name));
+        for (k = 0; auto_name[k]; k++) guard[k] = (char)toupper((unsigned char)auto_name[k]);
+        guard[k] = '\0';
+        fprintf(f, "\n#ifndef __%s_H__\n#define __%s_H__\n", guard, guard);
+    }
+
+    for (k = i; k < argc; k++) {
+        if (!name) default_name(argv[k], auto_name, sizeof(auto_name));
+        err |= convert_file(f, argv[k], name ? name : auto_name, &o);
+    }
+
+    if (guard[0]) fprintf(f, "\n#endif\n");
+    if (out) fclose(f);
+    return err;
+}
@@ -0,0 +1,214 @@
+/*
+ * ================================================================
+ * digit_check.c: Lab 5.2 七段顯示器數字轉換檢查（Linux主機端）
+ * 功能：直接編譯 Lab-5/5.2/Q2.c，將 split_dec()、make_digits_U/S/X()
+ *       與改為不使用除法之前的版本比較全部256個數值、三種模式的
+ *       dig[]/mask[]；並以隨機的按鍵序列檢查 render_value() 的快取
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * include/ 內的替代BSP標頭讓 Q2.c 不經修改即可在主機編譯
+ * （main 改名為 lab_main，不會執行）。
+ *
+ * 用法：digitcheck
+ * 回傳值：任何數值或模式的 dig[]/mask[] 與原本不同，或 render_value()
+ *         重畫LCD的時機不對時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define main lab_main
+#include "Q2.c"
+#undef main
+
+#define CACHE_STEPS     100000
+
+// ================================================================
+// 替代的BSP函數
+// ================================================================
+GPIO_T dc_pe;
+static unsigned long s_lcd_lines;       // print_Line() 呼叫次數
+
+void CLK_SysTickDelay(uint32_t us) { (void)us; }
+void SYS_Init(void) {}
+void init_LCD(void) {}
+void clear_LCD(void) {}
+void print_Line(int8_t line, char text[]) { (void)line; (void)text; s_lcd_lines++; }
+void OpenKeyPad(void) {}
+uint8_t ScanKey(void) { return 0; }
+void OpenSevenSegment(void) {}
+void ShowSevenSegment(uint8_t no, uint8_t number) { (void)no; (void)number; }
+void CloseSevenSegment(void) {}
+
+// ================================================================
+// 原本的版本（以 / 與 % 拆位數），輸出到 old_dig/old_mask
+// ================================================================
+static unsigned char old_dig[4], old_mask[4];
+
+static void old_make_digits_U(unsigned int v)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) { old_dig[i] = 0; old_mask[i] = 0; }
+    if (v == 0) {
+        old_dig[0] = 0; old_dig[1] = 0; old_mask[0] = 1; old_mask[1] = 1;
+        return;
+    }
+    old_dig[0] = (unsigned char)(v % 10); old_mask[0] = 1; v /= 10;
+    if (v > 0) { old_dig[1] = (unsigned char)(v % 10); old_mask[1] = 1; v /= 10; }
+    if (v > 0) { old_dig[2] = (unsigned char)(v % 10); old_mask[2] = 1; v /= 10; }
+    if (v > 0) { old_dig[3] = (unsigned char)(v % 10); old_mask[3] = 1; }
+}
+
+static void old_make_digits_S(int val)
+{
+    int neg = (val < 0);
+    unsigned int a = (unsigned int)(neg ? -val : val);
+    int i, idx;
+
+    for (i = 0; i < 4; i++) { old_dig[i] = 0; old_mask[i] = 0; }
+    if (!neg) {
+        if (a == 0) {
+            old_dig[0] = 0; old_dig[1] = 0; old_mask[0] = 1; old_mask[1] = 1;
+            return;
+        }
+        idx = 0;
+        while (a > 0 && idx < 4) {
+            old_dig[idx] = a % 10;
+            old_mask[idx] = 1;
+            a /= 10;
+            idx++;
+        }
+    } else {
+        if (a >= 100) {
+            old_dig[3] = MINUS_CODE; old_mask[3] = 1;
+            old_dig[2] = (a / 100) % 10; old_mask[2] = 1;
+            old_dig[1] = (a / 10) % 10; old_mask[1] = 1;
+            old_dig[0] = a % 10; old_mask[0] = 1;
+        } else if (a >= 10) {
+            old_dig[2] = MINUS_CODE; old_mask[2] = 1;
+            old_dig[1] = a / 10; old_mask[1] = 1;
+            old_dig[0] = a % 10; old_mask[0] = 1;
+        } else {
+            old_dig[1] = MINUS_CODE; old_mask[1] = 1;
+            old_dig[0] = a; old_mask[0] = 1;
+        }
+    }
+}
+
+static void old_make_digits_X(unsigned char v)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) { old_dig[i] = 0; old_mask[i] = 0; }
+    old_dig[0] = (unsigned char)(v & 0x0F);
+    old_dig[1] = (unsigned char)((v >> 4) & 0x0F);
+    old_mask[0] = 1; old_mask[1] = 1;
+}
+
+static void old_render(unsigned char N, unsigned char mode)
+{
+    if (mode == 0) old_make_digits_U(N);
+    else if (mode == 1) old_make_digits_S((signed char)N);
+    else old_make_digits_X(N);
+}
+
+// dig[] 與 mask[] 完全相同（mask 為0的位數也比較）
+static int same_display(void)
+{
+    return !memcmp(dig, old_dig, sizeof(dig)) && !memcmp(mask, old_mask, sizeof(mask));
+}
+
+// ================================================================
+// 檢查
+// ================================================================
+static const char *const s_mode_name[3] = { "U", "S", "X" };
+
+static unsigned long check_values(void)
+{
+    unsigned long errors = 0;
+    unsigned int v, mode;
+    unsigned char h, t, o;
+
+    // split_dec() 對0-255 與 / % 相同
+    for (v = 0; v < 256; v++) {
+        split_dec(v, &h, &t, &o);
+        if (h != v / 100 || t != (v / 10) % 10 || o != v % 10) {
+            if (errors++ < 10) printf("  split_dec(%u) = %u %u %u\n", v, h, t, o);
+        }
+    }
+
+    for (mode = 0; mode < 3; mode++) {
+        for (v = 0; v < 256; v++) {
+            if (mode == 0) make_digits_U(v);
+            else if (mode == 1) make_digits_S((signed char)v);
+            else make_digits_X((unsigned char)v);
+            old_render((unsigned char)v, (unsigned char)mode);
+            if (!same_display()) {
+                if (errors++ < 10)
+                    printf("  %s %3u: dig %u %u %u %u mask %u%u%u%u, was dig %u %u %u %u mask %u%u%u%u\n",
+                           s_mode_name[mode], v, dig[3], dig[2], dig[1], dig[0],
+                           mask[3], mask[2], mask[1], mask[0],
+                           old_dig[3], old_dig[2], old_dig[1], old_dig[0],
+                           old_mask[3], old_mask[2], old_mask[1], old_mask[0]);
+            }
+        }
+    }
+    return errors;
+}
+
+// 隨機的按鍵序列（數值與模式各自改變或不變）：每一步的畫面與原本相同，
+// LCD只在第一次與數值改變時重畫
+static unsigned long check_cache(unsigned long *redraws, unsigned long *old_redraws)
+{
+    unsigned long errors = 0, expect = 0, k;
+    unsigned char N = 0, mode = 0, prev_N = 0, prev_mode = 0;
+    int first = 1;
+
+    shown_valid = 0;
+    s_lcd_lines = 0;
+    *old_redraws = 0;
+    srand(1);
+    for (k = 0; k < CACHE_STEPS; k++) {
+        switch (rand() % 4) {
+        case 0: N = (unsigned char)rand(); break;
+        case 1: mode = (unsigned char)(rand() % 3); break;
+        case 2: break;                          // 沒有按鍵
+        default: N = (unsigned char)rand(); mode = (unsigned char)(rand() % 3); break;
+        }
+
+        render_value(N, mode);
+        if (first || N != prev_N) expect++;
+        if (first || N != prev_N || mode != prev_mode) (*old_redraws)++;   // 原本的主迴圈
+
+        old_render(N, mode);
+        if (!same_display() || s_lcd_lines != expect) {
+            if (errors++ < 10)
+                printf("  step %lu: N %u mode %s, LCD lines %lu (expected %lu)\n",
+                       k, N, s_mode_name[mode], s_lcd_lines, expect);
+            s_lcd_lines = expect;
+        }
+        prev_N = N;
+        prev_mode = mode;
+        first = 0;
+    }
+    *redraws = s_lcd_lines;
+    return errors;
+}
+
+int main(void)
+{
+    unsigned long errors, cache_errors, redraws, old_redraws;
+
+    errors = check_values();
+    printf("values: %s (split_dec 0-255; make_digits U/S/X, 256 values each, vs / %% version)\n",
+           errors ? "FAIL" : "ok");
+
+    cache_errors = check_cache(&redraws, &old_redraws);
+    printf("render_value: %s (%d random key steps; LCD binary redrawn %lu times, was %lu)\n",
+           cache_errors ? "FAIL" : "ok", CACHE_STEPS, redraws, old_redraws);
+
+    return (errors || cache_errors) ? 1 : 0;
+}
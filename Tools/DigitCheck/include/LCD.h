@@ -0,0 +1,14 @@
+/*
+ * LCD.h（DigitCheck替代版）: Lab 5.2 用到的LCD函式宣告
+ */
+
+#ifndef __LCD_H__
+#define __LCD_H__
+
+#include <stdint.h>
+
+void init_LCD(void);
+void clear_LCD(void);
+void print_Line(int8_t line, char text[]);
+
+#endif
@@ -0,0 +1,8 @@
+/*
+ * MCU_init.h（DigitCheck替代版）: 時脈設定不影響數字轉換，保持空白
+ */
+
+#ifndef __MCU_INIT_H__
+#define __MCU_INIT_H__
+
+#endif
@@ -0,0 +1,24 @@
+/*
+ * ================================================================
+ * NUC100Series.h（DigitCheck替代版）: 主機端編譯Lab 5.2用的最小定義
+ * 功能：PE->DOUT 對應到一般變數，CLK_SysTickDelay() 不等待
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __NUC100SERIES_H__
+#define __NUC100SERIES_H__
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t DOUT;
+} GPIO_T;
+
+extern GPIO_T dc_pe;
+
+#define PE  (&dc_pe)
+
+void CLK_SysTickDelay(uint32_t us);
+
+#endif
@@ -0,0 +1,10 @@
+/*
+ * SYS_init.h（DigitCheck替代版）: 與BSP相同的系統初始化宣告
+ */
+
+#ifndef __SYS_INIT_H__
+#define __SYS_INIT_H__
+
+void SYS_Init(void);
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Scankey.h（DigitCheck替代版）: 與BSP相同的3x3鍵盤函式宣告
+ */
+
+#ifndef __SCANKEY_H__
+#define __SCANKEY_H__
+
+#include <stdint.h>
+
+void OpenKeyPad(void);
+uint8_t ScanKey(void);
+
+#endif
@@ -0,0 +1,18 @@
+/*
+ * ================================================================
+ * LCD.h（LcdBench替代版）: 主機端的LCD傳輸函數
+ * 功能：lcdSetAddr()/lcdWriteData() 由 lcd_bench.c 提供，
+ *       只計算SPI3傳送位元組數並保存畫面內容
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __LCD_H__
+#define __LCD_H__
+
+#include <stdint.h>
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+void lcdWriteData(unsigned char temp);
+
+#endif
@@ -0,0 +1,494 @@
+/*
+ * ================================================================
+ * lcd_bench.c: LCD繪圖效能測試（Linux主機端）
+ * 功能：比較逐點 draw_Pixel()、影子緩衝區逐點、影子緩衝區page遮罩矩形
+ *       三種畫法的繪製速度（主機端，像素/微秒）與每次繪製的SPI3傳送位元組數，
+ *       以及球體逐點畫圓與快取圓形遮罩的每步時間，
+ *       並以逐點參考模型檢查矩形填滿/清除/反相、點陣圖各模式與圓形遮罩的結果
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 速度只計算修改緩衝區的CPU時間（主機上的SPI3是空函數）；
+ * 開發板上每個SPI3位元組都要等待傳送完成，因此另外列出傳送位元組數。
+ *
+ * 用法：lcdbench [-t 每項測試毫秒數]
+ * 回傳值：矩形/點陣圖/圓形結果與逐點參考模型不同，或LCD內容與影子緩衝區不同時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "LCD.h"
+#include "LCD_Shadow.h"
+#include "LCD_Circle.h"
+
+// ================================================================
+// 虛擬LCD：記錄SPI3傳送位元組數與面板內容
+// ================================================================
+#define PANEL_COLUMNS   132
+
+static uint8_t s_panel[LCD_SHADOW_PAGES][PANEL_COLUMNS];
+static uint8_t s_page, s_col;
+static unsigned long s_spi_bytes = 0;
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr)
+{
+    s_page = PageAddr;
+    s_col = ColumnAddr;
+    s_spi_bytes += 3;           // page、column高4位、column低4位
+}
+
+void lcdWriteData(unsigned char temp)
+{
+    s_panel[s_page][s_col] = temp;
+    s_col++;                    // 控制器column自動加1
+    s_spi_bytes++;
+}
+
+// 與LCD.c的 draw_Pixel() 相同的流程：修改自己的緩衝區後立即送出該位元組
+static uint8_t s_bsp_buf[LCD_SHADOW_PAGES * LCD_SHADOW_WIDTH];
+
+static void bsp_draw_Pixel(int16_t x, int16_t y, uint8_t color, int send)
+{
+    uint8_t *p = &s_bsp_buf[(y >> 3) * LCD_SHADOW_WIDTH + x];
+
+    if (color) *p |= (uint8_t)(1 << (y & 0x07));
+    else *p &= (uint8_t)~(1 << (y & 0x07));
+    if (!send) return;
+    lcdSetAddr((uint8_t)(y >> 3), (uint8_t)(LCD_SHADOW_WIDTH + 1 - x));
+    lcdWriteData(*p);
+}
+
+// ================================================================
+// 亂數（固定種子，結果可重現）
+// ================================================================
+static uint32_t s_seed = 12345;
+
+static uint32_t rnd(uint32_t n)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return (s_seed >> 8) % n;
+}
+
+static double now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/*
+ * ================================================================
+ * 正確性檢查：隨機矩形（含超出畫面）對照逐點參考模型
+ * ================================================================
+ */
+static uint8_t s_ref[LCD_SHADOW_HEIGHT][LCD_SHADOW_WIDTH];
+
+// 影子緩衝區與參考模型相同、且LCD內容與影子緩衝區相同時回傳0
+static int compare(void)
+{
+    int x, y, page;
+
+    for (y = 0; y < LCD_SHADOW_HEIGHT; y++) {
+        for (x = 0; x < LCD_SHADOW_WIDTH; x++) {
+            if (((LCD_shadowRead((uint8_t)(y >> 3), (uint8_t)x) >> (y & 0x07)) & 0x01) != s_ref[y][x]) {
+                printf("FAIL: shadow pixel (%d,%d) differs from reference\n", x, y);
+                return 1;
+            }
+        }
+    }
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        for (x = 0; x < LCD_SHADOW_WIDTH; x++) {
+            if (s_panel[page][LCD_SHADOW_WIDTH + 1 - x] != LCD_shadowRead((uint8_t)page, (uint8_t)x)) {
+                printf("FAIL: LCD page %d x %d differs from shadow buffer\n", page, x);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int check_rects(void)
+{
+    int n, x, y, x0, y0, x1, y1, lo_x, hi_x, lo_y, hi_y, op;
+
+    LCD_shadowInit();
+    memset(s_ref, 0, sizeof(s_ref));
+
+    for (n = 0; n < 20000; n++) {
+        x0 = (int)rnd(160) - 16;
+        x1 = (int)rnd(160) - 16;
+        y0 = (int)rnd(96) - 16;
+        y1 = (int)rnd(96) - 16;
+        op = (int)rnd(3);
+
+        if (op == 0) LCD_shadowFillRect(x0, y0, x1, y1, 1);
+        else if (op == 1) LCD_shadowClearRect(x0, y0, x1, y1);
+        else LCD_shadowInvertRect(x0, y0, x1, y1);
+
+        lo_x = x0 < x1 ? x0 : x1;
+        hi_x = x0 < x1 ? x1 : x0;
+        lo_y = y0 < y1 ? y0 : y1;
+        hi_y = y0 < y1 ? y1 : y0;
+        for (y = lo_y; y <= hi_y; y++) {
+            for (x = lo_x; x <= hi_x; x++) {
+                if (x < 0 || x >= LCD_SHADOW_WIDTH || y < 0 || y >= LCD_SHADOW_HEIGHT) continue;
+                s_ref[y][x] = (op == 0) ? 1 : (op == 1) ? 0 : !s_ref[y][x];
+            }
+        }
+
+        if ((n & 0x0F) == 0) LCD_shadowFlush(NULL);
+    }
+    LCD_shadowFlush(NULL);
+
+    if (compare()) return 1;
+    printf("check: 20000 random fill/clear/invert rects match the per-pixel reference and the LCD\n");
+    return 0;
+}
+
+/*
+ * ================================================================
+ * 正確性檢查：隨機大小、任意位置（含負值與超出畫面）的點陣圖，
+ * 六種模式對照逐點參考模型
+ * ================================================================
+ */
+static int check_blits(void)
+{
+    static uint8_t bmp[LCD_SHADOW_PAGES * LCD_SHADOW_WIDTH];
+    int n, i, x, y, bx, by, w, h, mode, bit;
+    uint8_t *r;
+
+    LCD_shadowInit();
+    memset(s_ref, 0, sizeof(s_ref));
+
+    for (n = 0; n < 20000; n++) {
+        w = 1 + (int)rnd(LCD_SHADOW_WIDTH);
+        h = 1 + (int)rnd(LCD_SHADOW_HEIGHT);
+        x = (int)rnd(LCD_SHADOW_WIDTH + w + 16) - w - 8;
+        y = (int)rnd(LCD_SHADOW_HEIGHT + h + 16) - h - 8;
+        mode = (int)rnd(6);
+        for (i = 0; i < ((h + 7) >> 3) * w; i++) bmp[i] = (uint8_t)rnd(256);
+
+        LCD_shadowBlit((int16_t)x, (int16_t)y, bmp, (uint8_t)w, (uint8_t)h, (uint8_t)mode);
+
+        for (by = 0; by < h; by++) {
+            for (bx = 0; bx < w; bx++) {
+                if (x + bx < 0 || x + bx >= LCD_SHADOW_WIDTH || y + by < 0 || y + by >= LCD_SHADOW_HEIGHT) continue;
+                bit = (bmp[(by >> 3) * w + bx] >> (by & 0x07)) & 0x01;
+                r = &s_ref[y + by][x + bx];
+                switch (mode) {
+                case LCD_BLIT_COPY:   *r = (uint8_t)bit; break;
+                case LCD_BLIT_OR:     *r |= (uint8_t)bit; break;
+                case LCD_BLIT_AND:    *r &= (uint8_t)bit; break;
+                case LCD_BLIT_XOR:    *r ^= (uint8_t)bit; break;
+                case LCD_BLIT_INVERT: *r = (uint8_t)!bit; break;
+                case LCD_BLIT_CLEAR:  *r &= (uint8_t)!bit; break;
+                }
+            }
+        }
+
+        if ((n & 0x0F) == 0) LCD_shadowFlush(NULL);
+    }
+    LCD_shadowFlush(NULL);
+
+    if (compare()) return 1;
+    printf("check: 20000 random copy/or/and/xor/invert/clear blits match the per-pixel reference and the LCD\n");
+    return 0;
+}
+
+/*
+ * ================================================================
+ * 正確性檢查：快取的圓形遮罩以 OR/CLEAR 繪製，對照逐點中點畫圓法
+ * （LCD_shadowCircle()）；半徑0-40、圓心可超出畫面，快取放不下的半徑
+ * 應回傳NULL
+ * ================================================================
+ */
+static void ref_plot(int x, int y, uint8_t color)
+{
+    if (x < 0 || x >= LCD_SHADOW_WIDTH || y < 0 || y >= LCD_SHADOW_HEIGHT) return;
+    s_ref[y][x] = color;
+}
+
+static void ref_circle(int xc, int yc, int r, uint8_t color)
+{
+    int x = 0, y = r, p = 3 - 2 * r;
+
+    while (x <= y) {
+        ref_plot(xc + x, yc + y, color);
+        ref_plot(xc - x, yc + y, color);
+        ref_plot(xc + x, yc - y, color);
+        ref_plot(xc - x, yc - y, color);
+        ref_plot(xc + y, yc + x, color);
+        ref_plot(xc - y, yc + x, color);
+        ref_plot(xc + y, yc - x, color);
+        ref_plot(xc - y, yc - x, color);
+        if (p < 0) {
+            p += 4 * x + 6;
+        } else {
+            p += 4 * (x - y) + 10;
+            y--;
+        }
+        x++;
+    }
+}
+
+static int check_circles(void)
+{
+    const uint8_t *m;
+    int n, xc, yc, r, color, cached = 0, missed = 0;
+
+    LCD_circleReset();
+    LCD_shadowInit();
+    memset(s_ref, 0, sizeof(s_ref));
+
+    for (n = 0; n < 20000; n++) {
+        r = (int)rnd(41);
+        xc = (int)rnd(LCD_SHADOW_WIDTH + 2 * r + 16) - r - 8;
+        yc = (int)rnd(LCD_SHADOW_HEIGHT + 2 * r + 16) - r - 8;
+        color = (int)rnd(2);
+
+        m = LCD_circleMask((int16_t)r);
+        if (m) {
+            LCD_shadowBlit((int16_t)(xc - r), (int16_t)(yc - r), m, LCD_CIRCLE_SIZE(r), LCD_CIRCLE_SIZE(r),
+                           color ? LCD_BLIT_OR : LCD_BLIT_CLEAR);
+            cached++;
+        } else {
+            LCD_shadowCircle((int16_t)xc, (int16_t)yc, (int16_t)r, (uint8_t)color);
+            missed++;
+        }
+        ref_circle(xc, yc, r, (uint8_t)color);
+
+        if ((n & 0x0F) == 0) LCD_shadowFlush(NULL);
+    }
+    LCD_shadowFlush(NULL);
+
+    if (compare()) return 1;
+    if (!cached || !missed) {
+        printf("FAIL: circle cache returned %d masks and %d misses\n", cached, missed);
+        return 1;
+    }
+    printf("check: 20000 random circles (%d from the mask cache, %d per pixel) match the reference and the LCD\n\n",
+           cached, missed);
+    return 0;
+}
+
+/*
+ * ================================================================
+ * 效能測試
+ * ================================================================
+ */
+typedef struct {
+    const char *name;
+    int w, h;
+    int even_y;                 // 1=Y座標為偶數（貪食蛇格子）
+} Shape;
+
+static const Shape s_shapes[] = {
+    { "2x2 snake cell", 2,   2,  1 },
+    { "5x5 block",      5,   5,  0 },
+    { "8x8 ball",       8,   8,  0 },
+    { "16x8 paddle",    16,  8,  0 },
+    { "128x64 screen",  128, 64, 0 },
+};
+#define SHAPE_COUNT     (sizeof(s_shapes) / sizeof(s_shapes[0]))
+
+typedef enum { PATH_BSP_PIXEL, PATH_SHADOW_PIXEL, PATH_SHADOW_RECT } Path;
+
+static const char *s_path_name[] = {
+    "draw_Pixel loop",
+    "shadow pixel",
+    "shadow rect",
+};
+#define PATH_COUNT      (sizeof(s_path_name) / sizeof(s_path_name[0]))
+
+// send=1 時同時送到LCD（draw_Pixel每點送出，影子緩衝區畫完後flush）
+static void draw(Path path, int x0, int y0, int w, int h, uint8_t color, int send)
+{
+    int x, y;
+
+    switch (path) {
+    case PATH_BSP_PIXEL:
+        for (x = x0; x < x0 + w; x++) {
+            for (y = y0; y < y0 + h; y++) bsp_draw_Pixel(x, y, color, send);
+        }
+        return;
+    case PATH_SHADOW_PIXEL:
+        for (x = x0; x < x0 + w; x++) {
+            for (y = y0; y < y0 + h; y++) LCD_shadowPixel(x, y, color);
+        }
+        break;
+    case PATH_SHADOW_RECT:
+        LCD_shadowFillRect(x0, y0, x0 + w - 1, y0 + h - 1, color);
+        break;
+    }
+    if (send) LCD_shadowFlush(NULL);
+}
+
+// 在隨機位置反覆畫出再清除，回傳繪製速度（像素/微秒），
+// *bytes 為另外送出1000次時每次繪製的SPI3位元組數
+static double bench(const Shape *sh, Path path, double run_us, double *bytes)
+{
+    unsigned long draws = 0, spi_start;
+    double start, elapsed = 0;
+    int x, y, k, send;
+
+    for (send = 1; send >= 0; send--) {
+        LCD_shadowInit();
+        memset(s_bsp_buf, 0, sizeof(s_bsp_buf));
+        s_seed = 12345;
+        draws = 0;
+        spi_start = s_spi_bytes;
+        start = now_us();
+
+        do {
+            for (k = 0; k < 50; k++) {
+                x = (int)rnd((uint32_t)(LCD_SHADOW_WIDTH - sh->w + 1));
+                y = (int)rnd((uint32_t)(LCD_SHADOW_HEIGHT - sh->h + 1));
+                if (sh->even_y) y &= ~1;
+                draw(path, x, y, sh->w, sh->h, 1, send);
+                draw(path, x, y, sh->w, sh->h, 0, send);
+                draws += 2;
+            }
+            elapsed = now_us() - start;
+        } while (send ? draws < 1000 : elapsed < run_us);
+
+        if (send) *bytes = (double)(s_spi_bytes - spi_start) / draws;
+    }
+    return (double)draws * sh->w * sh->h / elapsed;
+}
+
+/*
+ * ================================================================
+ * 球體動畫（Lab 7）：每一步擦除舊的球、在相鄰位置畫新的球
+ * ================================================================
+ */
+typedef enum { BALL_DRAW_CIRCLE, BALL_SHADOW_CIRCLE, BALL_SHADOW_MASK } BallPath;
+
+static const char *s_ball_name[] = {
+    "draw_Circle",
+    "shadow circle",
+    "shadow mask",
+};
+#define BALL_PATH_COUNT (sizeof(s_ball_name) / sizeof(s_ball_name[0]))
+
+// 與 Draw2D.c 的 draw_Circle() 相同：逐點以 draw_Pixel() 畫出並送出
+static void bsp_draw_Circle(int xc, int yc, int r, uint8_t color, int send)
+{
+    int x = 0, y = r, p = 3 - 2 * r;
+
+    while (x <= y) {
+        bsp_draw_Pixel(xc + x, yc + y, color, send);
+        bsp_draw_Pixel(xc - x, yc + y, color, send);
+        bsp_draw_Pixel(xc + x, yc - y, color, send);
+        bsp_draw_Pixel(xc - x, yc - y, color, send);
+        bsp_draw_Pixel(xc + y, yc + x, color, send);
+        bsp_draw_Pixel(xc - y, yc + x, color, send);
+        bsp_draw_Pixel(xc + y, yc - x, color, send);
+        bsp_draw_Pixel(xc - y, yc - x, color, send);
+        if (p < 0) {
+            p += 4 * x + 6;
+        } else {
+            p += 4 * (x - y) + 10;
+            y--;
+        }
+        x++;
+    }
+}
+
+static void ball(BallPath path, int xc, int yc, int r, uint8_t color, int send)
+{
+    const uint8_t *m;
+
+    switch (path) {
+    case BALL_DRAW_CIRCLE:
+        bsp_draw_Circle(xc, yc, r, color, send);
+        return;
+    case BALL_SHADOW_CIRCLE:
+        LCD_shadowCircle((int16_t)xc, (int16_t)yc, (int16_t)r, color);
+        break;
+    case BALL_SHADOW_MASK:
+        m = LCD_circleMask((int16_t)r);
+        LCD_shadowBlit((int16_t)(xc - r), (int16_t)(yc - r), m, LCD_CIRCLE_SIZE(r), LCD_CIRCLE_SIZE(r),
+                       color ? LCD_BLIT_OR : LCD_BLIT_CLEAR);
+        break;
+    }
+    if (send) LCD_shadowFlush(NULL);
+}
+
+// 球在畫面內斜向反彈，每步擦除+畫出（送出時擦除與畫出一起flush），
+// 回傳每步CPU時間（奈秒），*bytes 為每步的SPI3位元組數
+static double bench_ball(int r, BallPath path, double run_us, double *bytes)
+{
+    unsigned long steps = 0, spi_start;
+    double start, elapsed = 0;
+    int x, y, dx, dy, k, send;
+
+    for (send = 1; send >= 0; send--) {
+        LCD_circleReset();
+        LCD_shadowInit();
+        memset(s_bsp_buf, 0, sizeof(s_bsp_buf));
+        x = LCD_SHADOW_WIDTH / 2;
+        y = LCD_SHADOW_HEIGHT / 2;
+        dx = 1;
+        dy = -1;
+        steps = 0;
+        spi_start = s_spi_bytes;
+        ball(path, x, y, r, 1, send);
+        start = now_us();
+
+        do {
+            for (k = 0; k < 50; k++) {
+                ball(path, x, y, r, 0, path == BALL_DRAW_CIRCLE && send);
+                if (x + dx < r || x + dx >= LCD_SHADOW_WIDTH - r) dx = -dx;
+                if (y + dy < r || y + dy >= LCD_SHADOW_HEIGHT - r) dy = -dy;
+                x += dx;
+                y += dy;
+                ball(path, x, y, r, 1, send);
+                steps++;
+            }
+            elapsed = now_us() - start;
+        } while (send ? steps < 1000 : elapsed < run_us);
+
+        if (send) *bytes = (double)(s_spi_bytes - spi_start) / steps;
+    }
+    return elapsed * 1e3 / steps;
+}
+
+int main(int argc, char **argv)
+{
+    static const int radius[] = { 3, 4, 8 };
+    double run_us = 200e3, rate[PATH_COUNT], bytes[PATH_COUNT], ns[BALL_PATH_COUNT];
+    unsigned int i, p;
+
+    if (argc == 3 && !strcmp(argv[1], "-t")) {
+        run_us = atoi(argv[2]) * 1e3;
+        if (run_us <= 0) run_us = 1e3;
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [-t ms]\n", argv[0]);
+        return 2;
+    }
+
+    if (check_rects() || check_blits() || check_circles()) return 1;
+
+    printf("%-16s %-20s %12s %10s %14s\n", "shape", "path", "pixels/us", "speedup", "SPI bytes/draw");
+    for (i = 0; i < SHAPE_COUNT; i++) {
+        for (p = 0; p < PATH_COUNT; p++) {
+            rate[p] = bench(&s_shapes[i], (Path)p, run_us, &bytes[p]);
+            printf("%-16s %-20s %12.1f %9.1fx %14.1f\n", p ? "" : s_shapes[i].name,
+                   s_path_name[p], rate[p], rate[p] / rate[0], bytes[p]);
+        }
+    }
+
+    printf("\n%-16s %-20s %12s %10s %14s\n", "ball step", "path", "ns/step", "speedup", "SPI bytes/step");
+    for (i = 0; i < sizeof(radius) / sizeof(radius[0]); i++) {
+        for (p = 0; p < BALL_PATH_COUNT; p++) {
+            ns[p] = bench_ball(radius[i], (BallPath)p, run_us, &bytes[p]);
+            if (p == 0) printf("r=%-14d ", radius[i]);
+            else printf("%-16s ", "");
+            printf("%-20s %12.1f %9.1fx %14.1f\n", s_ball_name[p], ns[p], ns[0] / ns[p], bytes[p]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,387 @@
+/*
+ * ================================================================
+ * lcd_delta.c: 差異幀動畫編碼器（Linux主機端）
+ * 功能：從C原始碼讀出各幀點陣圖陣列，產生 Library/LCD_Delta.h 格式的
+ *       keyframe + XOR差異段，並以韌體的 LCD_Delta.c/LCD_Shadow.c
+ *       在虛擬LCD上播放，逐幀對照原始點陣圖
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：lcddelta [-w 寬度] [-n 名稱] [-o 輸出.h] 來源.c 陣列1 陣列2 ...
+ *   陣列依播放順序列出，每個陣列為 pages*寬度 位元組（格式同 draw_Bmp64x64()）；
+ *   初始值較少的陣列其餘補0（與C相同，如 Lab 10 Q1/Q2 的 green1[8 * 64] 只有504個初始值）
+ *   只有驗證通過時才寫出 -o 指定的檔案
+ * 回傳值：驗證失敗時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "LCD.h"
+#include "LCD_Shadow.h"
+#include "LCD_Delta.h"
+
+#define MAX_FRAMES      32
+#define MAX_BYTES       (LCD_SHADOW_PAGES * LCD_SHADOW_WIDTH)
+#define MAX_DELTA       (MAX_BYTES * 2 + 1)
+
+// 兩段之間不超過此數的未改變位元組就合併成一段：
+// 分開送需要多一次位址設定（3位元組），flash也多3位元組段標頭
+#define MERGE_GAP       LCD_SHADOW_ADDR_BYTES
+
+// 播放位置（與 Lab 10 相同）
+#define PLAY_X          32
+#define PLAY_PAGE       0
+
+// ================================================================
+// 虛擬LCD
+// ================================================================
+#define PANEL_COLUMNS   132
+
+static uint8_t s_panel[LCD_SHADOW_PAGES][PANEL_COLUMNS];
+static uint8_t s_page, s_col;
+static unsigned long s_spi_bytes = 0;
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr)
+{
+    s_page = PageAddr;
+    s_col = ColumnAddr;
+    s_spi_bytes += 3;
+}
+
+void lcdWriteData(unsigned char temp)
+{
+    s_panel[s_page][s_col] = temp;
+    s_col++;
+    s_spi_bytes++;
+}
+
+// ================================================================
+// 讀取C陣列：找到 "名稱[...] = {" 後讀取數字直到 "}"
+// ================================================================
+static char *read_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+    long n;
+
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)n + 1);
+    if (buf && fread(buf, 1, (size_t)n, f) != (size_t)n) {
+        free(buf);
+        buf = NULL;
+    }
+    if (buf) buf[n] = '\0';
+    fclose(f);
+    return buf;
+}
+
+static int is_ident(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+// 回傳讀到的位元組數，找不到時為-1
+static int read_array(const char *src, const char *name, uint8_t *out, int max)
+{
+    size_t len = strlen(name);
+    const char *p = src, *q;
+    char *end;
+    long v;
+    int n = 0;
+
+    while ((p = strstr(p, name)) != NULL) {
+        q = p + len;
+        if ((p == src || !is_ident(p[-1])) && !is_ident(*q)) {
+            while (isspace((unsigned char)*q)) q++;
+            if (*q == '[') {
+                q = strchr(q, '=');
+                if (q && (q = strchr(q, '{')) != NULL) break;
+            }
+        }
+        p += len;
+    }
+    if (!p) return -1;
+
+    q++;
+    while (*q && *q != '}') {
+        if (isdigit((unsigned char)*q)) {
+            v = strtol(q, &end, 0);
+            if (n >= max || v < 0 || v > 0xFF) return -1;
+            out[n++] = (uint8_t)v;
+            q = end;
+        } else {
+            q++;
+        }
+    }
+    return n;
+}
+
+/*
+ * ================================================================
+ * 編碼：每個page找出改變的位元組，間隔不超過 MERGE_GAP 的合併成一段
+ * ================================================================
+ */
+typedef struct {
+    uint8_t data[MAX_DELTA];
+    int size;                   // 位元組數（含結尾）
+    int changed;                // 改變的位元組數
+    int runs;
+} Delta;
+
+static void encode(const uint8_t *from, const uint8_t *to, int w, int pages, Delta *d)
+{
+    int page, x, c, start, last;
+    const uint8_t *a, *b;
+
+    d->size = 0;
+    d->changed = 0;
+    d->runs = 0;
+
+    for (page = 0; page < pages; page++) {
+        a = from + page * w;
+        b = to + page * w;
+        for (x = 0; x < w; x++) {
+            if (a[x] == b[x]) continue;
+
+            start = last = x;
+            for (c = x + 1; c < w && c - last - 1 <= MERGE_GAP; c++) {
+                if (a[c] != b[c]) last = c;
+            }
+
+            d->data[d->size++] = (uint8_t)page;
+            d->data[d->size++] = (uint8_t)start;
+            d->data[d->size++] = (uint8_t)(last - start + 1);
+            for (c = start; c <= last; c++) {
+                d->data[d->size++] = a[c] ^ b[c];
+                if (a[c] != b[c]) d->changed++;
+            }
+            d->runs++;
+            x = last;
+        }
+    }
+    d->data[d->size++] = LCD_DELTA_END;
+}
+
+/*
+ * ================================================================
+ * 驗證：以韌體播放器播放，每次換幀後比對虛擬LCD與原始點陣圖
+ * ================================================================
+ */
+static uint8_t s_frame[MAX_FRAMES][MAX_BYTES];
+static Delta s_delta[MAX_FRAMES];
+static const uint8_t *s_delta_ptr[MAX_FRAMES];
+
+static int check_frame(const LcdDeltaAnim *a, int frame)
+{
+    int page, x, expect;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        for (x = 0; x < LCD_SHADOW_WIDTH; x++) {
+            expect = 0;
+            if (page >= PLAY_PAGE && page < PLAY_PAGE + a->pages && x >= PLAY_X && x < PLAY_X + a->w) {
+                expect = s_frame[frame][(page - PLAY_PAGE) * a->w + x - PLAY_X];
+            }
+            if (s_panel[page][LCD_SHADOW_WIDTH + 1 - x] != expect ||
+                LCD_shadowRead((uint8_t)page, (uint8_t)x) != expect) {
+                printf("FAIL: frame %d, page %d x %d: LCD 0x%02X, shadow 0x%02X, expected 0x%02X\n",
+                       frame + 1, page, x, s_panel[page][LCD_SHADOW_WIDTH + 1 - x],
+                       LCD_shadowRead((uint8_t)page, (uint8_t)x), expect);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int verify(const LcdDeltaAnim *a, unsigned long *spi)
+{
+    // 依序播放兩圈，再測試跳幀與重畫keyframe
+    static const int skip[] = { 3, 1, 0, 2 };
+    LcdDeltaPlayer p;
+    unsigned int i;
+    int f;
+
+    LCD_shadowInit();
+    LCD_deltaInit(&p, a, PLAY_X, PLAY_PAGE);
+
+    for (f = 0; f < 2 * a->frames + 1; f++) {
+        spi[f % a->frames] = LCD_deltaShow(&p, (uint8_t)(f % a->frames));
+        if (check_frame(a, f % a->frames)) return 1;
+    }
+    for (i = 0; i < sizeof(skip) / sizeof(skip[0]); i++) {
+        f = skip[i] % a->frames;
+        if (i == 2) LCD_deltaInvalidate(&p);
+        LCD_deltaShow(&p, (uint8_t)f);
+        if (check_frame(a, f)) return 1;
+    }
+    return 0;
+}
+
+/*
+ * ================================================================
+ * 輸出標頭檔
+ * ================================================================
+ */
+// more=1 時最後一個位元組之後也加逗號（後面還有資料）
+static void write_bytes(FILE *f, const uint8_t *d, int n, int per_line, int more)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        fprintf(f, "%s0x%02X%s", (i % per_line) ? " " : "    ", d[i],
+                (i < n - 1 || more) ? "," : "");
+        if (i % per_line == per_line - 1 || i == n - 1) fprintf(f, "\n");
+    }
+}
+
+static int write_header(const char *path, const char *name, const LcdDeltaAnim *a,
+                        int argc, char **argv)
+{
+    FILE *f = fopen(path, "w");
+    const char *base = strrchr(path, '/');
+    char guard[64];
+    const uint8_t *d;
+    int i, k, len;
+
+    if (!f) return 1;
+    base = base ? base + 1 : path;
+    for (i = 0; name[i] && i < (int)sizeof(guard) - 1; i++) guard[i] = (char)toupper((unsigned char)name[i]);
+    guard[i] = '\0';
+
+    fprintf(f, "/*\n"
+               " * ================================================================\n"
+               " * %s: 差異幀動畫資料（%dx%d，%d幀）\n"
+               " * 由 Tools/LcdDelta 產生，請勿手動修改：\n"
+               " *   lcddelta", base, a->w, a->pages * 8, a->frames);
+    for (i = 0; i < argc; i++) fprintf(f, " %s", argv[i]);
+    fprintf(f, "\n"
+               " * ================================================================\n"
+               " */\n\n");
+    fprintf(f, "#ifndef __%s_H__\n#define __%s_H__\n\n", guard, guard);
+    fprintf(f, "#include \"LCD_Delta.h\"\n\n");
+
+    fprintf(f, "// 第1幀（keyframe）\n");
+    fprintf(f, "static const uint8_t %s_key[%d] = {\n", name, a->w * a->pages);
+    write_bytes(f, a->key, a->w * a->pages, 16, 0);
+    fprintf(f, "};\n");
+
+    for (k = 0; k < a->frames; k++) {
+        fprintf(f, "\n// 第%d幀 -> 第%d幀：%d段，每段 page, x, len, XOR資料\n",
+                k + 1, (k + 1) % a->frames + 1, s_delta[k].runs);
+        fprintf(f, "static const uint8_t %s_d%d[%d] = {\n", name, k, s_delta[k].size);
+        d = s_delta[k].data;
+        while (*d != LCD_DELTA_END) {
+            len = d[2];
+            write_bytes(f, d, 3 + len, 3 + len, 1);
+            d += 3 + len;
+        }
+        fprintf(f, "    LCD_DELTA_END\n};\n");
+    }
+
+    fprintf(f, "\nstatic const uint8_t * const %s_delta[%d] = {\n   ", name, a->frames);
+    for (k = 0; k < a->frames; k++) fprintf(f, " %s_d%d%s", name, k, (k == a->frames - 1) ? "\n" : ",");
+    fprintf(f, "};\n\n");
+    fprintf(f, "static const LcdDeltaAnim %s = { %d, %d, %d, %s_key, %s_delta };\n",
+            name, a->w, a->pages, a->frames, name, name);
+    fprintf(f, "\n#endif\n");
+
+    return fclose(f) != 0;
+}
+
+/*
+ * ================================================================
+ * 主程式
+ * ================================================================
+ */
+int main(int argc, char **argv)
+{
+    const char *out = NULL, *name = "anim", *src_path;
+    char *src;
+    unsigned long spi[MAX_FRAMES], blit;
+    int i, k, w = 64, n[MAX_FRAMES], size = 0, frames, flash = 0;
+    LcdDeltaAnim anim;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i += 2) {
+        if (i + 1 >= argc) break;
+        if (!strcmp(argv[i], "-w")) w = atoi(argv[i + 1]);
+        else if (!strcmp(argv[i], "-n")) name = argv[i + 1];
+        else if (!strcmp(argv[i], "-o")) out = argv[i + 1];
+        else break;
+    }
+    frames = argc - i - 1;
+    if (frames < 2 || frames > MAX_FRAMES || w < 1 || w > LCD_SHADOW_WIDTH) {
+        fprintf(stderr, "usage: %s [-w width] [-n name] [-o out.h] source.c array1 array2 ...\n", argv[0]);
+        return 2;
+    }
+    src_path = argv[i];
+    src = read_file(src_path);
+    if (!src) {
+        fprintf(stderr, "cannot read %s\n", src_path);
+        return 2;
+    }
+
+    for (k = 0; k < frames; k++) {
+        n[k] = read_array(src, argv[i + 1 + k], s_frame[k], MAX_BYTES);
+        if (n[k] <= 0) {
+            fprintf(stderr, "%s: array %s not found or too large\n", src_path, argv[i + 1 + k]);
+            return 2;
+        }
+        if (n[k] > size) size = n[k];
+    }
+    free(src);
+
+    size = (size + w - 1) / w * w;          // s_frame[] 為static，不足的部分已是0
+    if (size / w > LCD_SHADOW_PAGES) {
+        fprintf(stderr, "%s: %d bytes is more than %d pages of width %d\n", src_path, size, LCD_SHADOW_PAGES, w);
+        return 2;
+    }
+    for (k = 0; k < frames; k++) {
+        if (n[k] != size) printf("note: %s has %d initializers, padded with zeros to %d\n", argv[i + 1 + k], n[k], size);
+    }
+
+    for (k = 0; k < frames; k++) {
+        encode(s_frame[k], s_frame[(k + 1) % frames], w, size / w, &s_delta[k]);
+        s_delta_ptr[k] = s_delta[k].data;
+        flash += s_delta[k].size;
+    }
+
+    anim.w = (uint8_t)w;
+    anim.pages = (uint8_t)(size / w);
+    anim.frames = (uint8_t)frames;
+    anim.key = s_frame[0];
+    anim.delta = s_delta_ptr;
+
+    if (verify(&anim, spi)) return 1;
+
+    printf("%d frames of %dx%d (%d bytes each)\n\n", frames, w, anim.pages * 8, size);
+    printf("%-10s %8s %6s %11s %16s %14s\n", "change", "changed", "runs", "flash", "SPI bytes delta", "SPI bytes blit");
+    for (k = 0; k < frames; k++) {
+        // 對照：整幀以 LCD_shadowBlit() 覆蓋再 flush（每個page一段）
+        LCD_shadowInit();
+        LCD_shadowBlit(PLAY_X, PLAY_PAGE * 8, s_frame[k], (uint8_t)w, (uint8_t)(anim.pages * 8), LCD_BLIT_COPY);
+        LCD_shadowFlush(NULL);
+        LCD_shadowBlit(PLAY_X, PLAY_PAGE * 8, s_frame[(k + 1) % frames], (uint8_t)w,
+                       (uint8_t)(anim.pages * 8), LCD_BLIT_COPY);
+        blit = LCD_shadowFlush(NULL);
+
+        printf("%4d -> %-3d %8d %6d %11d %16lu %14lu\n", k + 1, (k + 1) % frames + 1,
+               s_delta[k].changed, s_delta[k].runs, s_delta[k].size, spi[(k + 1) % frames], blit);
+    }
+    printf("\nflash: %d raw -> %d (keyframe %d + deltas %d), %.1fx smaller\n",
+           frames * size, size + flash, size, flash, (double)(frames * size) / (size + flash));
+    printf("check: every frame decoded by LCD_Delta.c matches the source arrays on the LCD\n");
+
+    if (out) {
+        if (write_header(out, name, &anim, argc - 1, argv + 1)) {
+            fprintf(stderr, "cannot write %s\n", out);
+            return 2;
+        }
+        printf("wrote %s\n", out);
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * ================================================================
+ * NUC100Series.h（LcdDma替代版）: 主機端PDMA/SPI3暫存器模型
+ * 功能：讓 LCD_Dma.c 不經修改即可在Linux編譯，PDMA與SPI3的存取
+ *       都經過 lcd_dma_model.c，依虛擬時間逐字組傳送
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __NUC100SERIES_H__
+#define __NUC100SERIES_H__
+
+#include <stdint.h>
+
+// ---------------- SPI ----------------
+typedef struct {
+    uint32_t CNTRL;
+    uint32_t DIVIDER;
+    uint32_t SSR;
+    uint32_t RESERVE0;
+    uint32_t RX[2];
+    uint32_t RESERVE1[2];
+    uint32_t TX[2];
+    uint32_t RESERVE2[3];
+    uint32_t VARCLK;
+    uint32_t DMA;
+    uint32_t CNTRL2;
+    uint32_t FIFO_CTL;
+    uint32_t STATUS;
+} SPI_T;
+
+extern SPI_T model_spi3;
+#define SPI3    (&model_spi3)
+
+#define SPI_SS0                 0x1u
+#define SPI_SS_ACTIVE_LOW       0x0u
+#define SPI_DMA_TX_DMA_GO_Msk   0x1u
+
+int model_spi_busy(SPI_T *spi);             // 每次讀取都經過一小段虛擬時間
+void SPI_EnableAutoSS(SPI_T *spi, uint32_t ss, uint32_t level);
+
+#define SPI_IS_BUSY(spi)            model_spi_busy(spi)
+#define SPI_TRIGGER_TX_PDMA(spi)    ((spi)->DMA |= SPI_DMA_TX_DMA_GO_Msk)
+
+// ---------------- PDMA ----------------
+#define PDMA_SPI3_TX            7
+#define PDMA_SAR_INC            0x00000000u
+#define PDMA_SAR_FIX            0x00000020u
+#define PDMA_DAR_INC            0x00000000u
+#define PDMA_DAR_FIX            0x00000080u
+#define PDMA_WIDTH_8            0x00080000u
+#define PDMA_WIDTH_16           0x00100000u
+#define PDMA_WIDTH_32           0x00000000u
+#define PDMA_IER_BLKD_IE        0x2u
+#define PDMA_ISR_BLKD_IF        0x2u
+
+extern volatile uint32_t model_pdma_isr[9];
+
+void PDMA_Open(uint32_t mask);
+void PDMA_SetTransferMode(uint32_t ch, uint32_t peripheral, uint32_t scatter, uint32_t desc);
+void PDMA_SetTransferAddr(uint32_t ch, uint32_t src, uint32_t src_ctrl, uint32_t dst, uint32_t dst_ctrl);
+void PDMA_SetTransferCnt(uint32_t ch, uint32_t width, uint32_t count);
+void PDMA_EnableInt(uint32_t ch, uint32_t mask);
+void PDMA_Trigger(uint32_t ch);
+
+#define PDMA_GET_CH_INT_STS(ch)         (model_pdma_isr[ch])
+#define PDMA_CLR_CH_INT_FLAG(ch, mask)  (model_pdma_isr[ch] &= ~(mask))
+
+// ---------------- IRQ ----------------
+typedef enum {
+    PDMA_IRQn = 26
+} IRQn_Type;
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+
+#endif
@@ -0,0 +1,14 @@
+/*
+ * SYS.h（LcdDma替代版）: 模組時脈只記錄是否啟用
+ */
+
+#ifndef __SYS_H__
+#define __SYS_H__
+
+#include "NUC100Series.h"
+
+#define PDMA_MODULE     1
+
+void CLK_EnableModuleClock(uint32_t module);
+
+#endif
@@ -0,0 +1,537 @@
+/*
+ * ================================================================
+ * lcd_dma_model.c: LCD非同步送出的PDMA/SPI3暫存器模型（Linux主機端）
+ * 功能：以虛擬時間模擬9位元SPI3與PDMA通道，直接執行 Library/LCD_Dma.c、
+ *       LCD_Shadow.c，與 LCD_shadowFlush() 的阻塞寫法跑相同的畫面，
+ *       對照SPI3字組序列與LCD內容，並比較每個畫面CPU等待SPI3的時間
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：lcddma [-k SPI3時脈Hz] [-w 每個畫面的運算微秒數] [-f 畫面數]
+ * 回傳值：任一情境的字組序列、LCD內容、SS0或PDMA設定檢查不符時為1
+ *
+ * 模型：
+ * - 每個字組 9 個SPI3時脈；寫入TX0時記錄並開始移出，移出期間SPI_IS_BUSY為1
+ * - PDMA在SPI3閒置 PDMA_GAP_NS 後（且 TX_DMA_GO）搬下一個字組；最後一個
+ *   字組寫入TX0時就觸發完成中斷（與硬體相同，此時SPI3仍在移出）
+ * - lcdSetAddr()/lcdWriteData() 依 LCD.c 的寫法：手動拉低SS0、寫入、
+ *   等待SPI3完成、拉高SS0；每次讀取SPI_IS_BUSY經過 POLL_NS
+ * - 字組在SS0未致能時送出、或SPI3移出中又寫入，都算錯誤
+ * - 主程式的運算時間以 -w 指定，PDMA在這段時間內繼續傳送；
+ *   複製到傳送緩衝區的CPU時間不列入
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "SYS.h"
+#include "LCD.h"
+#include "LCD_Shadow.h"
+#include "LCD_Dma.h"
+
+#define POLL_NS         100         // 讀取一次SPI_IS_BUSY的時間
+#define PDMA_GAP_NS     200         // SPI3閒置到PDMA寫入下一個字組的時間
+#define PDMA_CHANNELS   9
+#define PANEL_COLUMNS   132
+
+extern void PDMA_IRQHandler(void);
+
+// ================================================================
+// SPI3與虛擬LCD
+// ================================================================
+SPI_T model_spi3;
+volatile uint32_t model_pdma_isr[PDMA_CHANNELS];
+
+static uint64_t s_now = 0;          // 虛擬時間（奈秒）
+static uint32_t s_word_ns;          // 一個字組的移出時間
+static uint64_t s_shift_end = 0;
+static uint64_t s_idle_at = 0;      // 上一個字組移出完成的時間
+static int s_shifting = 0;
+static int s_manual_ss = 0;         // LCD.c 手動拉低SS0
+static int s_auto_ss = 0;           // SPI_EnableAutoSS()
+
+static unsigned long s_errors = 0;  // SS0未致能、移出中寫入、PDMA設定錯誤
+static uint16_t *s_stream;          // 本次執行送出的字組
+static long s_stream_len = 0, s_stream_max = 0;
+
+static uint8_t s_panel[LCD_SHADOW_PAGES][PANEL_COLUMNS];
+static uint8_t s_page, s_col;
+
+static void error(const char *what)
+{
+    if (s_errors < 5) fprintf(stderr, "lcddma: %s at %.3f ms\n", what, s_now / 1e6);
+    s_errors++;
+}
+
+// LCD控制器：解讀命令與資料，資料寫入後column自動加1
+static void decode(uint16_t w)
+{
+    if (w & 0x100) {
+        if (s_page < LCD_SHADOW_PAGES && s_col < PANEL_COLUMNS) s_panel[s_page][s_col] = (uint8_t)w;
+        s_col++;
+    } else if ((w & 0xF0) == 0xB0) {
+        s_page = w & 0x0F;
+    } else if ((w & 0xF0) == 0x10) {
+        s_col = (uint8_t)((s_col & 0x0F) | ((w & 0x0F) << 4));
+    } else if ((w & 0xF0) == 0x00) {
+        s_col = (uint8_t)((s_col & 0xF0) | (w & 0x0F));
+    }
+}
+
+static void spi_send(uint16_t w)
+{
+    if (s_shifting) error("TX0 written while SPI3 busy");
+    if (!s_manual_ss && !s_auto_ss) error("word sent with SS0 inactive");
+    if (s_stream_len < s_stream_max) s_stream[s_stream_len] = w;
+    s_stream_len++;
+    decode(w);
+    s_shifting = 1;
+    s_shift_end = s_now + s_word_ns;
+}
+
+// ================================================================
+// PDMA
+// ================================================================
+typedef struct {
+    uint32_t src, dst, src_ctrl, dst_ctrl, width, bcr, cur;
+    uint32_t periph, ie;
+    int open, active;
+} Channel;
+
+static Channel s_ch[PDMA_CHANNELS];
+static int s_pdma_clock = 0, s_pdma_nvic = 0;
+
+static Channel *ready_channel(void)
+{
+    int i;
+
+    if (!(model_spi3.DMA & SPI_DMA_TX_DMA_GO_Msk)) return NULL;
+    for (i = 0; i < PDMA_CHANNELS; i++) {
+        if (s_ch[i].active && s_ch[i].periph == PDMA_SPI3_TX) return &s_ch[i];
+    }
+    return NULL;
+}
+
+// 搬一個字組到SPI3 TX0
+static void dma_step(Channel *c)
+{
+    int ch = (int)(c - s_ch);
+    uint16_t w;
+
+    if (!s_pdma_clock || !c->open) error("PDMA channel used without clock/open");
+    if (c->width != PDMA_WIDTH_16) error("PDMA width is not 16 bits");
+    if (c->dst != (uint32_t)(uintptr_t)&model_spi3.TX[0] || c->dst_ctrl != PDMA_DAR_FIX)
+        error("PDMA destination is not a fixed SPI3 TX0");
+
+    w = *(const uint16_t *)(uintptr_t)c->cur;
+    if (c->src_ctrl == PDMA_SAR_INC) c->cur += 2;
+    c->bcr -= 2;
+    spi_send(w);
+
+    if (c->bcr == 0) {
+        c->active = 0;
+        model_spi3.DMA &= ~SPI_DMA_TX_DMA_GO_Msk;
+        model_pdma_isr[ch] |= PDMA_ISR_BLKD_IF;
+        if ((c->ie & PDMA_IER_BLKD_IE) && s_pdma_nvic) PDMA_IRQHandler();
+    }
+}
+
+// 虛擬時間前進到 t（期間SPI3移出、PDMA搬資料、發生中斷）
+static void advance_to(uint64_t t)
+{
+    Channel *c;
+    uint64_t start;
+
+    for (;;) {
+        if (s_shifting) {
+            if (s_shift_end > t) break;
+            s_now = s_shift_end;
+            s_idle_at = s_now;
+            s_shifting = 0;
+        }
+        c = ready_channel();
+        if (!c) break;
+        start = s_idle_at + PDMA_GAP_NS;
+        if (start < s_now) start = s_now;
+        if (start > t) break;
+        s_now = start;
+        dma_step(c);
+    }
+    if (t > s_now) s_now = t;
+}
+
+// ---------------- BSP函式 ----------------
+int model_spi_busy(SPI_T *spi)
+{
+    (void)spi;
+    advance_to(s_now + POLL_NS);
+    return s_shifting;
+}
+
+void SPI_EnableAutoSS(SPI_T *spi, uint32_t ss, uint32_t level)
+{
+    (void)spi;
+    if (ss != SPI_SS0 || level != SPI_SS_ACTIVE_LOW) error("LCD SS must be SS0 active low");
+    s_auto_ss = 1;
+}
+
+void CLK_EnableModuleClock(uint32_t module)
+{
+    if (module == PDMA_MODULE) s_pdma_clock = 1;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if (irq == PDMA_IRQn) s_pdma_nvic = 1;
+}
+
+void PDMA_Open(uint32_t mask)
+{
+    int i;
+    for (i = 0; i < PDMA_CHANNELS; i++) {
+        if (mask & (1u << i)) s_ch[i].open = 1;
+    }
+}
+
+void PDMA_SetTransferMode(uint32_t ch, uint32_t peripheral, uint32_t scatter, uint32_t desc)
+{
+    (void)scatter;
+    (void)desc;
+    s_ch[ch].periph = peripheral;
+}
+
+void PDMA_SetTransferAddr(uint32_t ch, uint32_t src, uint32_t src_ctrl, uint32_t dst, uint32_t dst_ctrl)
+{
+    s_ch[ch].src = src;
+    s_ch[ch].src_ctrl = src_ctrl;
+    s_ch[ch].dst = dst;
+    s_ch[ch].dst_ctrl = dst_ctrl;
+}
+
+void PDMA_SetTransferCnt(uint32_t ch, uint32_t width, uint32_t count)
+{
+    s_ch[ch].width = width;
+    s_ch[ch].bcr = count * (width == PDMA_WIDTH_8 ? 1 : width == PDMA_WIDTH_16 ? 2 : 4);
+}
+
+void PDMA_EnableInt(uint32_t ch, uint32_t mask)
+{
+    s_ch[ch].ie |= mask;
+}
+
+void PDMA_Trigger(uint32_t ch)
+{
+    if (s_ch[ch].bcr == 0) error("PDMA triggered with no data");
+    s_ch[ch].cur = s_ch[ch].src;
+    s_ch[ch].active = 1;
+}
+
+// ---------------- LCD.c（阻塞寫法）----------------
+static void lcd_word(uint16_t w)
+{
+    s_auto_ss = 0;                  // SPI_SET_SS0_LOW() 會關閉自動SS
+    s_manual_ss = 1;
+    spi_send(w);
+    while (SPI_IS_BUSY(SPI3));
+    s_manual_ss = 0;
+}
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr)
+{
+    lcd_word(0xB0 | PageAddr);
+    lcd_word(0x10 | ((ColumnAddr >> 4) & 0xF));
+    lcd_word(0x00 | (ColumnAddr & 0xF));
+}
+
+void lcdWriteData(unsigned char temp)
+{
+    lcd_word(0x100 + temp);
+}
+
+// ================================================================
+// 情境：每個畫面只修改影子緩衝區，由執行程式決定送出方式
+// ================================================================
+typedef struct {
+    int x, y, w, h;
+} Box;
+
+static Box s_box[3], s_drawn[3];
+static int s_dx, s_dy;
+
+// 與 Lab 8 Q2 的 Draw_Game() 相同：擦除移動過的物件再重畫
+static void draw_boxes(int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (s_drawn[i].w && (s_drawn[i].x != s_box[i].x || s_drawn[i].y != s_box[i].y))
+            LCD_shadowFillRect(s_drawn[i].x, s_drawn[i].y,
+                               s_drawn[i].x + s_drawn[i].w - 1, s_drawn[i].y + s_drawn[i].h - 1, 0);
+    }
+    for (i = 0; i < n; i++) {
+        LCD_shadowFillRect(s_box[i].x, s_box[i].y, s_box[i].x + s_box[i].w - 1, s_box[i].y + s_box[i].h - 1, 1);
+        s_drawn[i] = s_box[i];
+    }
+}
+
+static void breakout(int frame)
+{
+    if (frame == 0) {
+        Box ball = { 60, 28, 8, 8 }, paddle = { 56, 56, 16, 8 }, obstacle = { 56, 8, 16, 8 };
+        s_box[0] = ball;
+        s_box[1] = paddle;
+        s_box[2] = obstacle;
+        memset(s_drawn, 0, sizeof(s_drawn));
+        s_dx = 4;
+        s_dy = 4;
+    }
+    s_box[0].x += s_dx;
+    s_box[0].y += s_dy;
+    if (s_box[0].x <= 0 || s_box[0].x >= 120) s_dx = -s_dx;
+    if (s_box[0].y <= 0 || s_box[0].y >= 48) s_dy = -s_dy;
+    s_box[1].x += (rand() % 9) - 4;
+    if (s_box[1].x < 0) s_box[1].x = 0;
+    if (s_box[1].x > 112) s_box[1].x = 112;
+    draw_boxes(3);
+}
+
+// Lab 9 貪食蛇：2x2格子，每步擦尾巴、畫新頭（一次送出）
+#define SNAKE_LEN   16
+static int s_sx[SNAKE_LEN], s_sy[SNAKE_LEN], s_head;
+
+static void snake(int frame)
+{
+    int i, nx, ny, tail;
+
+    if (frame == 0) {
+        for (i = 0; i < SNAKE_LEN; i++) {
+            s_sx[i] = 24 + i;
+            s_sy[i] = 16;
+            LCD_shadowFillRect(s_sx[i] * 2, s_sy[i] * 2, s_sx[i] * 2 + 1, s_sy[i] * 2 + 1, 1);
+        }
+        s_head = SNAKE_LEN - 1;
+        return;
+    }
+    tail = (s_head + 1) % SNAKE_LEN;
+    nx = s_sx[s_head];
+    ny = s_sy[s_head];
+    switch (rand() % 3) {
+    case 0:  nx = (nx + 1) % 64; break;
+    case 1:  ny = (ny + 1) % 32; break;
+    default: ny = (ny + 31) % 32; break;
+    }
+    LCD_shadowFillRect(s_sx[tail] * 2, s_sy[tail] * 2, s_sx[tail] * 2 + 1, s_sy[tail] * 2 + 1, 0);
+    s_sx[tail] = nx;
+    s_sy[tail] = ny;
+    s_head = tail;
+    LCD_shadowFillRect(nx * 2, ny * 2, nx * 2 + 1, ny * 2 + 1, 1);
+}
+
+// Lab 6 Q2：32x32圖片交替正常/反相
+static void blink(int frame)
+{
+    static uint8_t img[32 * 4];
+    int i;
+
+    if (frame == 0) {
+        for (i = 0; i < (int)sizeof(img); i++) img[i] = (uint8_t)rand();
+    }
+    LCD_shadowBlit(48, 0, img, 32, 32, (frame & 1) ? LCD_BLIT_INVERT : LCD_BLIT_COPY);
+}
+
+// 最壞情況：每個畫面整個畫面都改變
+static void full(int frame)
+{
+    static uint8_t img[LCD_SHADOW_PAGES * LCD_SHADOW_WIDTH];
+    int i;
+
+    (void)frame;
+    for (i = 0; i < (int)sizeof(img); i++) img[i] = (uint8_t)(rand() | 1);
+    LCD_shadowBlit(0, 0, img, LCD_SHADOW_WIDTH, LCD_SHADOW_HEIGHT, LCD_BLIT_XOR);
+}
+
+typedef struct {
+    const char *name;
+    void (*draw)(int frame);
+} Scenario;
+
+static const Scenario s_scenarios[] = {
+    { "lab8-breakout", breakout },
+    { "lab9-snake",    snake },
+    { "lab6-blink",    blink },
+    { "full-screen",   full },
+};
+
+// ================================================================
+// 執行
+// ================================================================
+typedef struct {
+    long words;             // 畫面送出的字組數（不含初始化）
+    uint64_t wait_ns;       // 送出函數佔用CPU的時間
+    unsigned long done;     // 完成通知次數
+    unsigned long flushes;  // 有資料的送出次數
+} Result;
+
+static unsigned long s_done_count = 0;
+
+static void on_done(void)
+{
+    s_done_count++;
+}
+
+static void reset_model(void)
+{
+    memset(&model_spi3, 0, sizeof(model_spi3));
+    memset((void *)model_pdma_isr, 0, sizeof(model_pdma_isr));
+    memset(s_ch, 0, sizeof(s_ch));
+    memset(s_panel, 0, sizeof(s_panel));
+    s_pdma_clock = s_pdma_nvic = 0;
+    s_now = s_idle_at = 0;
+    s_shifting = s_manual_ss = s_auto_ss = 0;
+    s_page = s_col = 0;
+    s_stream_len = 0;
+    s_done_count = 0;
+}
+
+// LCD內容是否與影子緩衝區相同（x 對應 column 129-x）
+static int panel_matches(void)
+{
+    int page, x;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        for (x = 0; x < LCD_SHADOW_WIDTH; x++) {
+            if (s_panel[page][LCD_SHADOW_WIDTH + 1 - x] != LCD_shadowRead((uint8_t)page, (uint8_t)x)) return 0;
+        }
+    }
+    return 1;
+}
+
+static void run(const Scenario *scn, int async, int frames, uint64_t work_ns, Result *r)
+{
+    long start;
+    uint64_t t0;
+    int f;
+
+    reset_model();
+    memset(r, 0, sizeof(*r));
+    srand(12345);
+
+    LCD_shadowInit();                   // 與韌體相同：DMA啟用前以阻塞方式清除畫面
+    if (async) LCD_dmaInit(on_done);
+    start = s_stream_len;
+
+    for (f = 0; f < frames; f++) {
+        advance_to(s_now + work_ns);    // 計算下一個畫面（PDMA同時傳送）
+        scn->draw(f);
+        t0 = s_now;
+        if (async) {
+            if (LCD_dmaFlush(NULL)) r->flushes++;
+        } else {
+            LCD_shadowFlush(NULL);
+        }
+        r->wait_ns += s_now - t0;
+    }
+    if (async) {
+        t0 = s_now;
+        LCD_dmaWait();
+        r->wait_ns += s_now - t0;
+        r->done = s_done_count;
+    }
+    r->words = s_stream_len - start;
+
+    // 之後直接使用SPI3（如 Lab 8 的 GAME OVER 畫面）：LCD_dmaWait() 返回時
+    // 傳送必須已經結束，否則這裡的寫入會與PDMA的最後一個字組重疊
+    LCD_shadowInvalidate();
+    LCD_shadowFlush(NULL);
+}
+
+// 傳送緩衝區小於整個畫面時：LCD_shadowStage() 分批取出，結果必須相同
+static int check_stage_chunks(void)
+{
+    static uint8_t img[LCD_SHADOW_PAGES * LCD_SHADOW_WIDTH];
+    uint16_t words[200];
+    uint16_t n, max;
+    int round, i;
+
+    srand(777);
+    for (round = 0; round < 200; round++) {
+        for (i = 0; i < (int)sizeof(img); i++) img[i] = (uint8_t)rand();
+        LCD_shadowBlit(rand() % 160 - 16, rand() % 80 - 8, img, (uint8_t)(1 + rand() % 128),
+                       (uint8_t)(1 + rand() % 64), (uint8_t)(rand() % 5));
+        max = (uint16_t)(LCD_SHADOW_ADDR_BYTES + LCD_SHADOW_WIDTH + rand() % 60);
+        while ((n = LCD_shadowStage(words, max, NULL)) > 0) {
+            for (i = 0; i < n; i++) decode(words[i]);
+        }
+        if (!panel_matches()) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long spi_hz = 1000000;
+    unsigned long work_us = 1000;
+    int frames = 500, i, n, fail = 0, same;
+    Result block, dma;
+    uint16_t *blocking_stream;
+    long blocking_len;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) spi_hz = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) work_us = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: lcddma [-k spi_hz] [-w work_us] [-f frames]\n");
+            return 1;
+        }
+    }
+    if ((uintptr_t)&model_spi3 > 0xFFFFFFFFu) {
+        fprintf(stderr, "lcddma: build with -no-pie so PDMA addresses fit in 32 bits\n");
+        return 1;
+    }
+    if (spi_hz == 0 || frames <= 0) return 1;
+    s_word_ns = (uint32_t)(9ULL * 1000000000ULL / spi_hz);
+
+    // 每個畫面最多整個畫面，另加開頭的 LCD_shadowInit() 與結尾的重送
+    s_stream_max = (long)(frames + 2) * LCD_SHADOW_MAX_WORDS;
+    s_stream = malloc(sizeof(uint16_t) * (size_t)s_stream_max);
+    blocking_stream = malloc(sizeof(uint16_t) * (size_t)s_stream_max);
+    if (!s_stream || !blocking_stream) return 1;
+
+    printf("SPI3 %lu Hz (%.1f us/word), %lu us of work per frame, %d frames\n\n",
+           spi_hz, s_word_ns / 1000.0, work_us, frames);
+    printf("%-14s %10s %14s %14s  %s\n", "scenario", "words/frm", "blocking us", "pdma us", "check");
+
+    n = (int)(sizeof(s_scenarios) / sizeof(s_scenarios[0]));
+    for (i = 0; i < n; i++) {
+        run(&s_scenarios[i], 0, frames, work_us * 1000ULL, &block);
+        blocking_len = s_stream_len;
+        if (blocking_len > s_stream_max) blocking_len = s_stream_max;
+        memcpy(blocking_stream, s_stream, sizeof(uint16_t) * (size_t)blocking_len);
+
+        run(&s_scenarios[i], 1, frames, work_us * 1000ULL, &dma);
+        same = (s_stream_len == blocking_len && blocking_len <= s_stream_max &&
+                memcmp(s_stream, blocking_stream, sizeof(uint16_t) * (size_t)blocking_len) == 0);
+        same = same && panel_matches() && dma.done == dma.flushes && s_errors == 0;
+
+        printf("%-14s %10.1f %14.1f %14.1f  %s\n", s_scenarios[i].name,
+               (double)dma.words / frames, block.wait_ns / 1000.0 / frames,
+               dma.wait_ns / 1000.0 / frames, same ? "same words" : "MISMATCH");
+        if (!same) fail = 1;
+    }
+
+    reset_model();
+    LCD_shadowInit();
+    if (!check_stage_chunks()) {
+        printf("\nstage: chunked LCD_shadowStage() output does not match the shadow buffer\n");
+        fail = 1;
+    } else {
+        printf("\nstage: 200 random blits drained in chunks of 131-190 words match the shadow buffer\n");
+    }
+    if (s_errors) printf("%lu SPI3/PDMA errors\n", s_errors);
+
+    free(s_stream);
+    free(blocking_stream);
+    return fail;
+}
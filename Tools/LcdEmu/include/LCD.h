@@ -0,0 +1,32 @@
+/*
+ * ================================================================
+ * LCD.h（LcdEmu替代版）: 與BSP相同的LCD函式宣告
+ * 功能：由 lcd_emu.c 以主機端的LCD控制器模型實作，
+ *       韌體的 Library/LCD_*.c 與測試程式直接呼叫
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __LCD_H__
+#define __LCD_H__
+
+#include <stdint.h>
+
+#define LCD_Xmax    128
+#define LCD_Ymax    64
+#define FG_COLOR    0xFFFF
+#define BG_COLOR    0x0000
+
+void init_LCD(void);
+void clear_LCD(void);
+void lcdWriteCommand(unsigned char temp);
+void lcdWriteData(unsigned char temp);
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+void printC(int16_t x, int16_t y, unsigned char ascii_code);
+void printS(int16_t x, int16_t y, char text[]);
+void print_Line(int8_t line, char text[]);
+void draw_LCD(unsigned char *buffer);
+void draw_Pixel(int16_t x, int16_t y, uint16_t fgColor, uint16_t bgColor);
+void draw_Bmp64x64(int16_t x, int16_t y, uint16_t fgColor, uint16_t bgColor, unsigned char bitmap[]);
+
+#endif
@@ -0,0 +1,15 @@
+/*
+ * ================================================================
+ * NUC100Series.h（LcdEmu替代版）: 主機端編譯用的空白定義
+ * 功能：LCD_Shadow.c、LCD_Text.c 等只經 LCD.h 的函數畫到LCD，
+ *       只需要標準整數型別
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __NUC100SERIES_H__
+#define __NUC100SERIES_H__
+
+#include <stdint.h>
+
+#endif
@@ -0,0 +1,267 @@
+/*
+ * ================================================================
+ * lcd_emu.c: LCD控制器模型與主機端BSP LCD函數
+ * 功能：lcdEmuWord() 解碼SPI3字組並更新顯示RAM；init_LCD()、clear_LCD()、
+ *       draw_LCD()、draw_Pixel()、draw_Bmp64x64()、printC()、printS()、
+ *       print_Line() 依 LCD.c 的寫法產生相同數量與順序的SPI3字組
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * BSP函數的傳送方式（與 LCD.c 相同）：
+ * - lcdSetAddr()：3個命令（page、column高4位元、column低4位元）
+ * - draw_Pixel()：修改 DisplayBuffer 的一個位元組並以 lcdSetAddr() + 1個資料送出
+ * - clear_LCD()：從 (0, 0) 連續送出 132x8 個0，並清除 DisplayBuffer
+ * - draw_LCD()：每個位元組各自 lcdSetAddr() + 1個資料（不更新 DisplayBuffer）
+ * - draw_Bmp64x64()：只對點亮的像素呼叫 draw_Pixel()
+ * - printC()：8x16格子逐點 draw_Pixel()（前景/背景都畫），每個字元512位元組
+ *
+ * 限制：BSP的8x16字型不在專案中，printC() 以 LCD_Font5x7 的字元畫在
+ * 格子的 (1, 4)，其餘為背景；傳送量與順序和 LCD.c 相同，畫面上的字形不同。
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "LCD.h"
+#include "LCD_Font5x7.h"
+#include "lcd_emu.h"
+
+// ================================================================
+// 控制器狀態
+// ================================================================
+static uint8_t s_ram[LCD_EMU_PAGES][LCD_EMU_COLUMNS];
+static uint8_t s_page, s_col;
+static uint8_t s_start;                 // 顯示起始行
+static uint8_t s_on, s_inverse, s_all_on;
+static uint8_t s_contrast;
+static uint8_t s_wait_contrast;         // 0x81 之後的下一個位元組是對比值
+
+static LcdEmuStats s_stats;
+static uint8_t s_last[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];  // 上一個畫面的面板內容
+
+void lcdEmuReset(void)
+{
+    memset(s_ram, 0, sizeof(s_ram));
+    s_page = 0;
+    s_col = 0;
+    s_start = 0;
+    s_on = 0;
+    s_inverse = 0;
+    s_all_on = 0;
+    s_contrast = 0;
+    s_wait_contrast = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+    memset(s_last, 0, sizeof(s_last));
+}
+
+static void emu_command(uint8_t c)
+{
+    s_stats.cmds++;
+
+    if (s_wait_contrast) {
+        s_contrast = c;
+        s_wait_contrast = 0;
+        return;
+    }
+
+    if ((c & 0xF0) == 0xB0) {
+        s_page = c & 0x0F;
+        s_stats.addr++;
+    } else if ((c & 0xF0) == 0x10) {
+        s_col = (uint8_t)((s_col & 0x0F) | ((c & 0x0F) << 4));
+        s_stats.addr++;
+    } else if ((c & 0xF0) == 0x00) {
+        s_col = (uint8_t)((s_col & 0xF0) | (c & 0x0F));
+        s_stats.addr++;
+    } else if ((c & 0xC0) == 0x40) {
+        s_start = c & 0x3F;
+    } else if (c == 0x81) {
+        s_wait_contrast = 1;
+    } else if (c == 0xAE || c == 0xAF) {
+        s_on = c & 1;
+    } else if (c == 0xA6 || c == 0xA7) {
+        s_inverse = c & 1;
+    } else if (c == 0xA4 || c == 0xA5) {
+        s_all_on = c & 1;
+    } else if (c == 0xE2) {
+        s_page = 0;                     // 系統重設：RAM內容保留
+        s_col = 0;
+        s_start = 0;
+    } else if ((c & 0xF0) == 0x20 || (c & 0xF8) == 0xC0 || (c & 0xFC) == 0xE8 ||
+               (c & 0xF8) == 0x88 || c == 0xA0 || c == 0xA1) {
+        // 溫度補償、電源、LCD對應、偏壓、RAM位址控制、頻率：不影響畫面
+    } else {
+        s_stats.unknown++;
+    }
+}
+
+static void emu_data(uint8_t d)
+{
+    uint8_t *cell;
+
+    s_stats.data++;
+    if (s_page < LCD_EMU_PAGES && s_col < LCD_EMU_COLUMNS) {
+        cell = &s_ram[s_page][s_col];
+        if (*cell == d) s_stats.redundant++;
+        *cell = d;
+    }
+
+    // column自動加1，超過最後一個column時換到下一個page
+    if (++s_col >= LCD_EMU_COLUMNS) {
+        s_col = 0;
+        s_page = (uint8_t)((s_page + 1) % LCD_EMU_PAGES);
+    }
+}
+
+void lcdEmuWord(uint16_t w)
+{
+    s_stats.words++;
+    if (w & 0x100) emu_data((uint8_t)w);
+    else emu_command((uint8_t)w);
+}
+
+int lcdEmuPixel(int x, int y)
+{
+    int row;
+
+    if (x < 0 || x >= LCD_EMU_WIDTH || y < 0 || y >= LCD_EMU_HEIGHT) return 0;
+    if (!s_on) return 0;
+    if (s_all_on) return 1;
+    row = (y + s_start) % LCD_EMU_HEIGHT;
+    return ((s_ram[row >> 3][129 - x] >> (row & 7)) & 1) ^ s_inverse;
+}
+
+void lcdEmuFrame(LcdEmuStats *stats)
+{
+    int x, y, p;
+
+    for (y = 0; y < LCD_EMU_HEIGHT; y++)
+        for (x = 0; x < LCD_EMU_WIDTH; x++) {
+            p = lcdEmuPixel(x, y);
+            if (p != s_last[y][x]) s_stats.changed++;
+            s_last[y][x] = (uint8_t)p;
+        }
+    if (stats) *stats = s_stats;
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+int lcdEmuWritePbm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t row[LCD_EMU_WIDTH / 8];
+    int x, y;
+
+    if (!f) return -1;
+    fprintf(f, "P4\n%d %d\n", LCD_EMU_WIDTH, LCD_EMU_HEIGHT);
+    for (y = 0; y < LCD_EMU_HEIGHT; y++) {
+        memset(row, 0, sizeof(row));
+        for (x = 0; x < LCD_EMU_WIDTH; x++)
+            if (lcdEmuPixel(x, y)) row[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+        fwrite(row, 1, sizeof(row), f);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+/*
+ * ================================================================
+ * BSP LCD函數（LCD.c）
+ * ================================================================
+ */
+static unsigned char DisplayBuffer[LCD_Xmax * LCD_Ymax / 8];
+
+void lcdWriteCommand(unsigned char temp)
+{
+    lcdEmuWord(temp);
+}
+
+void lcdWriteData(unsigned char temp)
+{
+    lcdEmuWord((uint16_t)(0x100 | temp));
+}
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr)
+{
+    lcdWriteCommand(0xB0 | PageAddr);
+    lcdWriteCommand(0x10 | ((ColumnAddr >> 4) & 0xF));
+    lcdWriteCommand(0x00 | (ColumnAddr & 0xF));
+}
+
+void init_LCD(void)
+{
+    lcdWriteCommand(0xEB);
+    lcdWriteCommand(0x81);
+    lcdWriteCommand(0xA0);
+    lcdWriteCommand(0xC0);
+    lcdWriteCommand(0xAF);
+}
+
+void clear_LCD(void)
+{
+    int16_t i;
+
+    lcdSetAddr(0x0, 0x0);
+    for (i = 0; i < 132 * 8; i++) lcdWriteData(0x00);
+    memset(DisplayBuffer, 0, sizeof(DisplayBuffer));
+}
+
+void draw_LCD(unsigned char *buffer)
+{
+    int x, y;
+
+    for (x = 0; x < LCD_Xmax; x++)
+        for (y = 0; y < LCD_Ymax / 8; y++) {
+            lcdSetAddr(y, (LCD_Xmax + 1 - x));
+            lcdWriteData(buffer[x + y * LCD_Xmax]);
+        }
+}
+
+void draw_Pixel(int16_t x, int16_t y, uint16_t fgColor, uint16_t bgColor)
+{
+    unsigned char *b;
+
+    (void)bgColor;
+    if (x < 0 || x >= LCD_Xmax || y < 0 || y >= LCD_Ymax) return;
+    b = &DisplayBuffer[x + y / 8 * LCD_Xmax];
+    if (fgColor != 0) *b |= (unsigned char)(0x01 << (y % 8));
+    else *b &= (unsigned char)~(0x01 << (y % 8));
+    lcdSetAddr(y / 8, (LCD_Xmax + 1 - x));
+    lcdWriteData(*b);
+}
+
+void draw_Bmp64x64(int16_t x, int16_t y, uint16_t fgColor, uint16_t bgColor, unsigned char bitmap[])
+{
+    int16_t t, i, k;
+
+    for (i = 0; i < 8; i++)
+        for (t = 0; t < 64; t++)
+            for (k = 0; k < 8; k++)
+                if (bitmap[i * 64 + t] & (1 << k))
+                    draw_Pixel(x + t, y + i * 8 + k, fgColor, bgColor);
+}
+
+void printC(int16_t x, int16_t y, unsigned char ascii_code)
+{
+    const uint8_t *glyph = LCD_font5x7Glyph((char)ascii_code);
+    int16_t i, j;
+    uint8_t on;
+
+    for (i = 0; i < 8; i++)
+        for (j = 0; j < 16; j++) {
+            on = (i >= 1 && i <= LCD_FONT5X7_W && j >= 4 && j < 4 + LCD_FONT5X7_H) &&
+                 ((glyph[i - 1] >> (j - 4)) & 1);
+            draw_Pixel(x + i, y + j, on ? FG_COLOR : BG_COLOR, on ? BG_COLOR : FG_COLOR);
+        }
+}
+
+void printS(int16_t x, int16_t y, char text[])
+{
+    int8_t i;
+
+    for (i = 0; text[i] != '\0'; i++) printC(x + i * 8, y, text[i]);
+}
+
+void print_Line(int8_t line, char text[])
+{
+    int8_t i;
+
+    for (i = 0; text[i] != '\0' && i < 16; i++) printC(i * 8, line * 16, text[i]);
+}
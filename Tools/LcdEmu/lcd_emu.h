@@ -0,0 +1,55 @@
+/*
+ * ================================================================
+ * lcd_emu.h: LCD控制器模型（Linux主機端）
+ * 功能：解碼SPI3的9位元字組（bit8=0命令、1資料），維護控制器的
+ *       顯示RAM與顯示狀態，統計每個畫面的命令/資料/重複寫入數，
+ *       並把面板內容寫成PBM圖檔
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 控制器（UC1601，init_LCD() 的命令）：
+ * - 0xB0|p 設定page，0x10|hi / 0x00|lo 設定column，資料寫入後column加1，
+ *   超過131時回到0並換到下一個page（clear_LCD() 以此連續清除整個RAM）
+ * - 0x40|l 顯示起始行：面板第 y 列顯示RAM第 (y + l) % 64 列
+ * - 0xA6/0xA7 正常/反相、0xA4/0xA5 正常/全亮、0xAE/0xAF 關閉/開啟顯示、
+ *   0x81 之後一個位元組為對比值；其他命令只計數
+ * - 面板左右鏡像：畫面第 x 行是RAM第 129-x 個column（同 LCD.c）
+ */
+
+#ifndef __LCD_EMU_H__
+#define __LCD_EMU_H__
+
+#include <stdint.h>
+
+#define LCD_EMU_WIDTH       128
+#define LCD_EMU_HEIGHT      64
+#define LCD_EMU_PAGES       8
+#define LCD_EMU_COLUMNS     132
+
+// 一個畫面（上一次 lcdEmuFrame() 之後）的統計
+typedef struct {
+    uint32_t words;         // SPI3字組數（命令 + 資料）
+    uint32_t cmds;          // 命令位元組數（含位址設定）
+    uint32_t addr;          // 其中page/column位址命令數
+    uint32_t data;          // 資料位元組數
+    uint32_t redundant;     // 與RAM原值相同的資料位元組數（不需送出）
+    uint32_t unknown;       // 無法辨識的命令數
+    uint32_t changed;       // 面板上改變的像素數（與上一個畫面比較）
+} LcdEmuStats;
+
+// 控制器上電：RAM清為0、起始行0、顯示關閉，統計歸零
+void lcdEmuReset(void);
+
+// 收到一個SPI3字組
+void lcdEmuWord(uint16_t w);
+
+// 結束一個畫面：回傳這個畫面的統計（stats可為NULL）並開始下一個畫面
+void lcdEmuFrame(LcdEmuStats *stats);
+
+// 面板上 (x, y) 的像素（含起始行、反相、全亮與顯示開關），1=點亮
+int lcdEmuPixel(int x, int y);
+
+// 把面板內容寫成PBM（P4）；失敗時回傳-1
+int lcdEmuWritePbm(const char *path);
+
+#endif
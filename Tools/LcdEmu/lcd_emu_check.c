@@ -0,0 +1,284 @@
+/*
+ * ================================================================
+ * lcd_emu_check.c: 文字行快取與硬體捲動主控台的隨機操作檢查
+ * 功能：在LCD控制器模型上執行 Library/LCD_Text.c 與 Library/LCD_Console.c，
+ *       以隨機的操作序列對照參考結果，每個操作之後比較整個面板
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * LCD_Text：同一組隨機操作執行兩次，一次以 LCD_textLine()、一次以
+ * print_Line()（BSP寫法），每個操作之後面板的雜湊值必須相同。操作包含
+ * 各行寫入（常與畫面上相同或只差幾個字元、超過16個字元）、清除畫面，
+ * 以及其他函數直接畫到文字區域（之後 LCD_textInvalidate()）。
+ *
+ * LCD_Console：以最近8行文字推算面板應有的內容（最舊一行在最上方，
+ * 未使用的行空白），直接捲動與平滑捲動各執行一次隨機的
+ * LCD_consolePrint()/LCD_consoleUpdate()/LCD_consoleClear()；平滑捲動時
+ * 每個 LCD_consoleTick() 之後也檢查：捲動第 j 列時畫面是
+ * [清空的最舊一行, 其餘7行, 空白] 往上移 j 列，第8列後才出現新的一行。
+ *
+ * 用法：lcdemucheck [-n 操作數]
+ * 回傳值：任何一個操作之後面板與參考不同時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LCD.h"
+#include "LCD_Text.h"
+#include "LCD_Console.h"
+#include "LCD_Font5x7.h"
+#include "lcd_emu.h"
+
+#define MAX_OPS         200000
+
+static unsigned long s_errors;
+
+// 面板內容的雜湊值（FNV-1a，每個像素一個位元）
+static uint64_t panel_hash(void)
+{
+    uint64_t h = 1469598103934665603ull;
+    int x, y;
+
+    for (y = 0; y < LCD_EMU_HEIGHT; y++)
+        for (x = 0; x < LCD_EMU_WIDTH; x++) {
+            h ^= (uint64_t)lcdEmuPixel(x, y);
+            h *= 1099511628211ull;
+        }
+    return h;
+}
+
+// 隨機文字：字元集很小，常與上一次相同或只差幾個字元
+static void random_text(char *text, int max, const char *prev)
+{
+    static const char set[] = "0123 AB:#";
+    int len = rand() % (max + 1), i;
+
+    if (prev && rand() % 2) {
+        strcpy(text, prev);
+        len = (int)strlen(text);
+        for (i = rand() % 3; i > 0 && len > 0; i--) text[rand() % len] = set[rand() % (int)(sizeof(set) - 1)];
+        return;
+    }
+    for (i = 0; i < len; i++) text[i] = set[rand() % (int)(sizeof(set) - 1)];
+    text[len] = '\0';
+}
+
+/*
+ * ================================================================
+ * LCD_Text：與 print_Line() 比較
+ * ================================================================
+ */
+static uint64_t s_hash[MAX_OPS];
+
+static unsigned long text_run(long ops, int cached)
+{
+    static char last[LCD_TEXT_LINES][24];
+    char text[24];
+    long k;
+    int line, i;
+    unsigned long glyphs = 0;
+
+    lcdEmuReset();
+    init_LCD();
+    clear_LCD();
+    if (cached) LCD_textInit();
+    memset(last, 0, sizeof(last));
+    srand(1);
+
+    for (k = 0; k < ops; k++) {
+        switch (rand() % 20) {
+        case 0:                                 // 清除畫面
+            if (cached) LCD_textClear();
+            else clear_LCD();
+            memset(last, 0, sizeof(last));
+            break;
+        case 1:                                 // 其他函數畫到文字區域
+            for (i = rand() % 40; i > 0; i--)
+                draw_Pixel((int16_t)(rand() % LCD_Xmax), (int16_t)(rand() % LCD_Ymax), FG_COLOR, BG_COLOR);
+            if (cached) LCD_textInvalidate();
+            break;
+        default:                                // 寫入一行（最多20個字元，超過16的部分忽略）
+            line = rand() % LCD_TEXT_LINES;
+            random_text(text, 20, last[line]);
+            strcpy(last[line], text);
+            if (cached) glyphs += LCD_textLine((uint8_t)line, text);
+            else {
+                print_Line((int8_t)line, text);
+                glyphs += strlen(text) < LCD_TEXT_COLS ? strlen(text) : LCD_TEXT_COLS;
+            }
+            break;
+        }
+
+        if (!cached) s_hash[k] = panel_hash();
+        else if (s_hash[k] != panel_hash()) {
+            if (s_errors++ < 10) printf("  LCD_text: op %ld differs from print_Line()\n", k);
+        }
+    }
+    return glyphs;
+}
+
+static void check_text(long ops)
+{
+    unsigned long before = s_errors, bsp, cached;
+
+    bsp = text_run(ops, 0);
+    cached = text_run(ops, 1);
+    printf("LCD_textLine: %s (%ld random ops vs print_Line(); glyphs drawn %lu, was %lu)\n",
+           s_errors == before ? "ok" : "FAIL", ops, cached, bsp);
+}
+
+/*
+ * ================================================================
+ * LCD_Console：與最近8行文字推算的畫面比較
+ * ================================================================
+ */
+typedef char ConsoleLine[LCD_CONSOLE_COLS];
+
+static ConsoleLine s_line[LCD_CONSOLE_LINES];   // 最近的行，0=最舊
+static int s_count;                             // 行數（0-8）
+static int s_shift = -1;                        // 平滑捲動已前進的列數（-1=沒有捲動）
+
+static void set_line(ConsoleLine dst, const char *text)
+{
+    int i;
+
+    for (i = 0; i < LCD_CONSOLE_COLS && text[i] != '\0'; i++) dst[i] = text[i];
+    for (; i < LCD_CONSOLE_COLS; i++) dst[i] = ' ';
+}
+
+// 一行文字第 r 列、第 x 個像素（每格5行字型 + 1行間隔，最右邊2行空白）
+static int line_pixel(const char *t, int r, int x)
+{
+    int cell = x / (LCD_FONT5X7_W + 1), k = x % (LCD_FONT5X7_W + 1);
+
+    if (!t || cell >= LCD_CONSOLE_COLS || k >= LCD_FONT5X7_W) return 0;
+    return (LCD_font5x7Glyph(t[cell])[k] >> r) & 1;
+}
+
+// 畫面第 y 列應該顯示的行與列
+static const char *expected_row(int y, int *r)
+{
+    int slot;
+
+    if (s_shift < 0) {
+        *r = y % 8;
+        return (y / 8 < s_count) ? s_line[y / 8] : NULL;
+    }
+    // 捲動中：[清空的最舊一行, 最新8行中的前7行, 空白] 往上移 s_shift 列
+    slot = (y + s_shift) / 8;
+    *r = (y + s_shift) % 8;
+    return (slot >= 1 && slot <= LCD_CONSOLE_LINES - 1) ? s_line[slot - 1] : NULL;
+}
+
+static void console_compare(const char *what, long k)
+{
+    const char *t;
+    int x, y, r, diff = 0;
+
+    for (y = 0; y < LCD_EMU_HEIGHT; y++) {
+        t = expected_row(y, &r);
+        for (x = 0; x < LCD_EMU_WIDTH; x++)
+            if (lcdEmuPixel(x, y) != line_pixel(t, r, x)) diff++;
+    }
+    if (diff && s_errors++ < 10)
+        printf("  LCD_console: op %ld (%s, scroll %d): %d pixels differ\n", k, what, s_shift, diff);
+}
+
+// 完成捲動（下一個操作開始前，LCD_Console.c 會先完成上一次捲動）
+static void console_finish(void)
+{
+    s_shift = -1;
+}
+
+static void console_print(const char *text, uint8_t smooth)
+{
+    console_finish();
+    if (s_count < LCD_CONSOLE_LINES) {
+        set_line(s_line[s_count++], text);
+        return;
+    }
+    memmove(s_line[0], s_line[1], sizeof(ConsoleLine) * (LCD_CONSOLE_LINES - 1));
+    set_line(s_line[LCD_CONSOLE_LINES - 1], text);
+    if (smooth) s_shift = 0;
+}
+
+static void console_run(long ops, uint8_t smooth, unsigned long *ticks)
+{
+    char text[32];
+    long k;
+    int r, t;
+
+    lcdEmuReset();
+    init_LCD();
+    LCD_consoleInit(smooth);
+    s_count = 0;
+    s_shift = -1;
+    srand(2 + smooth);
+
+    for (k = 0; k < ops; k++) {
+        r = rand() % 100;
+        if (r == 0) {                           // 清除
+            LCD_consoleClear();
+            s_count = 0;
+            console_finish();
+            console_compare("clear", k);
+        } else if (r < 45) {                    // 加一行（最多25個字元，超過21的部分忽略）
+            random_text(text, 25, NULL);
+            LCD_consolePrint(text);
+            console_print(text, smooth);
+            console_compare("print", k);
+        } else {                                // 修改最下方一行
+            random_text(text, 25, NULL);
+            LCD_consoleUpdate(text);
+            if (s_count == 0) console_print(text, smooth);
+            else set_line(s_line[s_count - 1], text);
+            console_compare("update", k);
+        }
+
+        // 平滑捲動：隨機數量的tick，每一步都檢查
+        if (smooth) {
+            for (t = rand() % 10; t > 0; t--) {
+                LCD_consoleTick();
+                (*ticks)++;
+                if (s_shift >= 0 && ++s_shift == 8) s_shift = -1;
+                console_compare("tick", k);
+            }
+        }
+    }
+    LCD_consoleExit();
+}
+
+static void check_console(long ops)
+{
+    unsigned long before = s_errors, ticks = 0;
+
+    console_run(ops, 0, &ticks);
+    printf("LCD_console direct: %s (%ld random print/update/clear ops)\n",
+           s_errors == before ? "ok" : "FAIL", ops);
+
+    before = s_errors;
+    console_run(ops, 1, &ticks);
+    printf("LCD_console smooth: %s (%ld random ops, %lu ticks, panel checked after each)\n",
+           s_errors == before ? "ok" : "FAIL", ops, ticks);
+}
+
+int main(int argc, char **argv)
+{
+    long ops = 20000;
+
+    if (argc == 3 && !strcmp(argv[1], "-n")) {
+        ops = atol(argv[2]);
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [-n ops]\n", argv[0]);
+        return 2;
+    }
+    if (ops < 1 || ops > MAX_OPS) {
+        fprintf(stderr, "lcdemucheck: ops must be 1-%d\n", MAX_OPS);
+        return 2;
+    }
+
+    check_text(ops);
+    check_console(ops);
+    return s_errors ? 1 : 0;
+}
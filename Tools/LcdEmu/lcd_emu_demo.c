@@ -0,0 +1,715 @@
+/*
+ * ================================================================
+ * lcd_emu_demo.c: LCD控制器模型主程式
+ * 功能：以BSP的LCD函數與 Library/LCD_*.c 畫出各實驗相同的畫面，
+ *       統計每個畫面的命令、資料、重複寫入與改變的像素數，
+ *       檢查兩種畫法的面板內容相同，並可把每個畫面寫成PBM
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：lcdemu [-s 情境名稱關鍵字] [-o PBM輸出目錄]
+ *   PBM檔名：<目錄>/<情境>-<畫法>-<畫面編號>.pbm
+ * 回傳值：同一情境中應該相同的畫法面板內容不同時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "LCD.h"
+#include "LCD_Shadow.h"
+#include "LCD_Delta.h"
+#include "LCD_Text.h"
+#include "LCD_Console.h"
+#include "Snake_Body.h"
+#include "Snake_Render.h"
+#include "green_walk.h"
+#include "lcd_emu.h"
+
+#define MAX_FRAMES      64
+#define WALK_X          32              // Lab-10/Q2.c 的動畫位置
+#define WALK_LOOPS      2
+
+// ================================================================
+// 畫面記錄與比對
+// ================================================================
+typedef struct {
+    const char *name;
+    uint8_t compare;                    // 1=面板內容必須與第一個畫法相同
+    void (*run)(void);
+} Variant;
+
+typedef struct {
+    const char *name;
+    const char *note;
+    const Variant *variants;
+} Scenario;
+
+static const char *s_out_dir = NULL;
+static const char *s_scenario, *s_variant;
+static int s_frame;
+static LcdEmuStats s_sum;
+static uint32_t s_max_data;
+
+static uint8_t s_ref[MAX_FRAMES][LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+static int s_ref_frames;
+static int s_recording;                 // 1=記錄為參考，0=與參考比對
+static uint8_t s_compare;
+static unsigned long s_mismatch;
+
+// 設定完成（init_LCD、clear_LCD 等）：不計入畫面統計
+static void setup_done(void)
+{
+    lcdEmuFrame(NULL);
+    s_frame = 0;
+}
+
+// 一個畫面完成
+static void frame_done(void)
+{
+    LcdEmuStats st;
+    char path[512];
+    int x, y, diff = 0;
+
+    lcdEmuFrame(&st);
+    s_sum.words += st.words;
+    s_sum.cmds += st.cmds;
+    s_sum.addr += st.addr;
+    s_sum.data += st.data;
+    s_sum.redundant += st.redundant;
+    s_sum.unknown += st.unknown;
+    s_sum.changed += st.changed;
+    if (st.data > s_max_data) s_max_data = st.data;
+
+    if (s_frame < MAX_FRAMES) {
+        for (y = 0; y < LCD_EMU_HEIGHT; y++)
+            for (x = 0; x < LCD_EMU_WIDTH; x++) {
+                if (s_recording) s_ref[s_frame][y][x] = (uint8_t)lcdEmuPixel(x, y);
+                else if (s_compare && s_frame < s_ref_frames &&
+                         s_ref[s_frame][y][x] != lcdEmuPixel(x, y)) diff++;
+            }
+        if (s_recording) s_ref_frames = s_frame + 1;
+        if (diff) {
+            printf("  MISMATCH %s/%s frame %d: %d pixels\n", s_scenario, s_variant, s_frame, diff);
+            s_mismatch++;
+        }
+    }
+
+    if (s_out_dir) {
+        snprintf(path, sizeof(path), "%s/%s-%s-%02d.pbm", s_out_dir, s_scenario, s_variant, s_frame);
+        if (lcdEmuWritePbm(path) != 0) {
+            fprintf(stderr, "lcdemu: cannot write %s\n", path);
+            exit(2);
+        }
+    }
+    s_frame++;
+}
+
+/*
+ * ================================================================
+ * Lab 10 綠色小人（64x64，6幀）
+ * ================================================================
+ */
+static uint8_t s_walk[6][512];          // 由keyframe與差異資料還原的各幀
+
+static void walk_frames(void)
+{
+    const uint8_t *d;
+    uint8_t page, x, len, i;
+    int f;
+
+    memcpy(s_walk[0], green_walk.key, sizeof(s_walk[0]));
+    for (f = 1; f < green_walk.frames; f++) {
+        memcpy(s_walk[f], s_walk[f - 1], sizeof(s_walk[f]));
+        for (d = green_walk.delta[f - 1]; *d != LCD_DELTA_END; d += 3 + len) {
+            page = d[0];
+            x = d[1];
+            len = d[2];
+            for (i = 0; i < len; i++) s_walk[f][page * 64 + x + i] ^= d[3 + i];
+        }
+    }
+}
+
+// 原始寫法：每幀 clear_LCD() 後逐點 draw_Bmp64x64()
+static void walk_bsp(void)
+{
+    int f;
+
+    init_LCD();
+    clear_LCD();
+    setup_done();
+    for (f = 0; f < green_walk.frames * WALK_LOOPS; f++) {
+        clear_LCD();
+        draw_Bmp64x64(WALK_X, 0, FG_COLOR, BG_COLOR, s_walk[f % green_walk.frames]);
+        frame_done();
+    }
+}
+
+// 原始寫法（整個畫面）：每幀組成128x64緩衝區後 draw_LCD()
+static void walk_draw_lcd(void)
+{
+    static unsigned char buf[LCD_Xmax * LCD_Ymax / 8];
+    int f, page;
+
+    init_LCD();
+    clear_LCD();
+    setup_done();
+    for (f = 0; f < green_walk.frames * WALK_LOOPS; f++) {
+        memset(buf, 0, sizeof(buf));
+        for (page = 0; page < 8; page++)
+            memcpy(&buf[page * LCD_Xmax + WALK_X], &s_walk[f % green_walk.frames][page * 64], 64);
+        draw_LCD(buf);
+        frame_done();
+    }
+}
+
+// 影子緩衝區：每幀以 LCD_shadowBlit() 覆蓋後只送出改變的column
+static void walk_shadow(void)
+{
+    int f;
+
+    init_LCD();
+    LCD_shadowInit();
+    setup_done();
+    for (f = 0; f < green_walk.frames * WALK_LOOPS; f++) {
+        LCD_shadowBlit(WALK_X, 0, s_walk[f % green_walk.frames], 64, 64, LCD_BLIT_COPY);
+        LCD_shadowFlush(NULL);
+        frame_done();
+    }
+}
+
+// 差異幀（Lab-10/Q2.c）：LCD_deltaShow()
+static void walk_delta(void)
+{
+    LcdDeltaPlayer player;
+    int f;
+
+    init_LCD();
+    LCD_shadowInit();
+    LCD_deltaInit(&player, &green_walk, WALK_X, 0);
+    setup_done();
+    for (f = 0; f < green_walk.frames * WALK_LOOPS; f++) {
+        LCD_deltaShow(&player, (uint8_t)(f % green_walk.frames));
+        frame_done();
+    }
+}
+
+static const Variant s_walk_variants[] = {
+    { "bmp64",    0, walk_bsp      },
+    { "draw_LCD", 1, walk_draw_lcd },
+    { "shadow",   1, walk_shadow   },
+    { "delta",    1, walk_delta    },
+    { NULL, 0, NULL }
+};
+
+/*
+ * ================================================================
+ * Lab 10 按鍵狀態列（Lance_bmp_first.c）：標題 + "Keypad: N"
+ * ================================================================
+ */
+#define KEYPAD_FRAMES   20
+
+static void keypad_text(int f, char *text)
+{
+    static const uint8_t keys[] = { 0, 0, 5, 5, 5, 0, 1, 2, 3, 0, 9, 9, 0, 4, 6, 8, 0, 7, 7, 0 };
+    sprintf(text, "Keypad: %d", keys[f % (int)sizeof(keys)]);
+}
+
+static void keypad_bsp(void)
+{
+    char text[17];
+    int f;
+
+    init_LCD();
+    clear_LCD();
+    setup_done();
+    for (f = 0; f < KEYPAD_FRAMES; f++) {
+        print_Line(0, "LCD_Keypad");
+        keypad_text(f, text);
+        print_Line(1, text);
+        frame_done();
+    }
+}
+
+static void keypad_text_cache(void)
+{
+    char text[17];
+    int f;
+
+    init_LCD();
+    clear_LCD();
+    LCD_textInit();
+    setup_done();
+    for (f = 0; f < KEYPAD_FRAMES; f++) {
+        LCD_textLine(0, "LCD_Keypad");
+        keypad_text(f, text);
+        LCD_textLine(1, text);
+        frame_done();
+    }
+}
+
+static const Variant s_keypad_variants[] = {
+    { "print_Line", 0, keypad_bsp        },
+    { "text",       1, keypad_text_cache },
+    { NULL, 0, NULL }
+};
+
+/*
+ * ================================================================
+ * Lab 5.1 密碼嘗試紀錄：每次按鍵或結果為一個畫面
+ * ================================================================
+ */
+#define LOG_ATTEMPTS    12
+#define LOG_TICKS       8               // 平滑捲動：每個畫面之間的 LCD_consoleTick() 次數
+
+// 第 f 個畫面：每次嘗試4個數字 + 結果，回傳1表示新的一行
+static int log_text(int f, char *text)
+{
+    static const char *pw[] = { "1234", "4321", "1111", "0000", "2580", "9999" };
+    int attempt = f / 5, step = f % 5;
+    const char *p = pw[attempt % 6];
+
+    if (step < 4) {
+        memcpy(text, p, (size_t)step + 1);
+        text[step + 1] = '\0';
+    } else {
+        sprintf(text, "%s %s", p, attempt % 6 == 0 ? "PASS" : "ERROR");
+    }
+    return step == 0;
+}
+
+// 4行紀錄以 print_Line() 捲動：新的一行時4行全部重畫（空白補滿16格）
+static void log_bsp(void)
+{
+    char lines[4][17], text[17];
+    int f, n = 0, i;
+
+    init_LCD();
+    clear_LCD();
+    setup_done();
+    for (f = 0; f < LOG_ATTEMPTS * 5; f++) {
+        if (log_text(f, text)) {
+            if (n == 4) {
+                memmove(lines[0], lines[1], sizeof(lines[0]) * 3);
+                n = 3;
+            }
+            n++;
+            sprintf(lines[n - 1], "%-16s", text);
+            for (i = 0; i < n; i++) print_Line((int8_t)i, lines[i]);
+        } else {
+            sprintf(lines[n - 1], "%-16s", text);
+            print_Line((int8_t)(n - 1), lines[n - 1]);
+        }
+        frame_done();
+    }
+}
+
+static void log_console(uint8_t smooth)
+{
+    char text[17];
+    int f, t;
+
+    init_LCD();
+    LCD_consoleInit(smooth);
+    setup_done();
+    for (f = 0; f < LOG_ATTEMPTS * 5; f++) {
+        if (log_text(f, text)) LCD_consolePrint(text);
+        else LCD_consoleUpdate(text);
+        if (smooth) for (t = 0; t < LOG_TICKS; t++) LCD_consoleTick();
+        frame_done();
+    }
+    LCD_consoleExit();
+}
+
+static void log_console_direct(void) { log_console(0); }
+static void log_console_smooth(void) { log_console(1); }
+
+static const Variant s_log_variants[] = {
+    { "print_Line", 0, log_bsp            },
+    { "console",    0, log_console_direct },
+    { "smooth",     0, log_console_smooth },
+    { NULL, 0, NULL }
+};
+
+/*
+ * ================================================================
+ * Lab 9 貪食蛇（Q2-final）：沿著走遍64x32盤面的路徑前進，
+ * 水果放在頭的前方，吃到時增長；蛇身長度不同的情境
+ * ================================================================
+ */
+#define SNAKE_TICKS     MAX_FRAMES
+#define SNAKE_CELLS     (SNAKE_GRID_W * SNAKE_GRID_H)
+#define FRUIT_AHEAD     9               // 水果在頭前方第幾格
+
+static int8_t s_path_x[SNAKE_CELLS], s_path_y[SNAKE_CELLS];
+static SnakeBody s_snake;
+
+// 封閉路徑：第0行以外逐列來回，再沿第0行回到起點
+static void snake_path(void)
+{
+    int n = 0, x, y;
+
+    for (y = 0; y < SNAKE_GRID_H; y++) {
+        if (y % 2 == 0) for (x = 1; x < SNAKE_GRID_W; x++) { s_path_x[n] = x; s_path_y[n++] = y; }
+        else for (x = SNAKE_GRID_W - 1; x >= 1; x--) { s_path_x[n] = x; s_path_y[n++] = y; }
+    }
+    for (y = SNAKE_GRID_H - 1; y >= 0; y--) { s_path_x[n] = 0; s_path_y[n++] = y; }
+}
+
+// 原本的寫法：改變的格子與整條蛇、水果都重畫到影子緩衝區後一次送出
+// （LCD_dmaFlush() 送出的字組與 LCD_shadowFlush() 相同）
+static void snake_block(int8_t gx, int8_t gy, uint8_t color)
+{
+    LCD_shadowFillRect(gx * 2, gy * 2, gx * 2 + 1, gy * 2 + 1, color);
+}
+
+// 由尾到頭重畫每一節
+static void snake_redraw(void)
+{
+    int8_t bx = SNAKE_BODY_TAIL_X(&s_snake), by = SNAKE_BODY_TAIL_Y(&s_snake);
+
+    do snake_block(bx, by, 1);
+    while (Snake_bodyNext(&s_snake, &bx, &by));
+}
+
+static void snake_run(uint16_t len, uint8_t render)
+{
+    int pos, fruit, t;
+    int8_t tx, ty;
+
+    if (!s_path_x[1]) snake_path();
+    init_LCD();
+    Snake_bodyInit(&s_snake);
+    for (pos = 0; pos < len; pos++) Snake_bodyPush(&s_snake, s_path_x[pos], s_path_y[pos]);
+    fruit = (pos + FRUIT_AHEAD) % SNAKE_CELLS;
+    if (render) {
+        Snake_renderAll(&s_snake, s_path_x[fruit], s_path_y[fruit]);
+    } else {
+        LCD_shadowInit();
+        snake_redraw();
+        snake_block(s_path_x[fruit], s_path_y[fruit], 1);
+        LCD_shadowFlush(NULL);
+    }
+    setup_done();
+
+    for (t = 0; t < SNAKE_TICKS; t++, pos = (pos + 1) % SNAKE_CELLS) {
+        if (pos == fruit) {
+            // 吃到水果：尾巴不動，新的水果放在前方
+            Snake_bodyPush(&s_snake, s_path_x[pos], s_path_y[pos]);
+            fruit = (pos + FRUIT_AHEAD) % SNAKE_CELLS;
+            if (render) {
+                Snake_renderCell(s_path_x[pos], s_path_y[pos]);
+                Snake_renderCell(s_path_x[fruit], s_path_y[fruit]);
+            } else {
+                snake_block(s_path_x[pos], s_path_y[pos], 1);
+                snake_block(s_path_x[fruit], s_path_y[fruit], 1);
+            }
+        } else {
+            Snake_bodyPop(&s_snake, &tx, &ty);
+            Snake_bodyPush(&s_snake, s_path_x[pos], s_path_y[pos]);
+            if (render) {
+                Snake_renderCell(tx, ty);
+                Snake_renderCell(s_path_x[pos], s_path_y[pos]);
+            } else {
+                snake_block(tx, ty, 0);
+                snake_block(s_path_x[pos], s_path_y[pos], 1);
+            }
+        }
+
+        if (render) {
+            Snake_renderFlush(&s_snake, s_path_x[fruit], s_path_y[fruit], NULL);
+        } else {
+            snake_redraw();                             // 斷尾修復
+            snake_block(s_path_x[fruit], s_path_y[fruit], 1);
+            LCD_shadowFlush(NULL);
+        }
+        frame_done();
+    }
+}
+
+static void snake16_shadow(void)    { snake_run(16, 0); }
+static void snake16_render(void)    { snake_run(16, 1); }
+static void snake100_shadow(void)   { snake_run(100, 0); }
+static void snake100_render(void)   { snake_run(100, 1); }
+static void snake1000_shadow(void)  { snake_run(1000, 0); }
+static void snake1000_render(void)  { snake_run(1000, 1); }
+
+static const Variant s_snake16_variants[] = {
+    { "shadow", 0, snake16_shadow },
+    { "render", 1, snake16_render },
+    { NULL, 0, NULL }
+};
+
+static const Variant s_snake100_variants[] = {
+    { "shadow", 0, snake100_shadow },
+    { "render", 1, snake100_render },
+    { NULL, 0, NULL }
+};
+
+static const Variant s_snake1000_variants[] = {
+    { "shadow", 0, snake1000_shadow },
+    { "render", 1, snake1000_render },
+    { NULL, 0, NULL }
+};
+
+/*
+ * ================================================================
+ * Lab 6 Q2 紅綠燈：初始狀態每500ms切換 (STOP白, GO黑) / (STOP黑, GO黑)
+ * ================================================================
+ */
+#define BLINK_TOGGLES   MAX_FRAMES
+#define BLINK_X         48              // (128-32)/2
+#define BLINK_SIZE      (32 * 4)
+
+// 與 Lab-6/Q2.c 的 go_white[]、stop_white[] 相同（黑色版本為反相）
+static const uint8_t s_go_white[BLINK_SIZE] = {
+0x00,0xFE,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xF2,0x0A,0x3A,0x02,0xEA,0x02,0xF2,0x0A,0x0A,0x0A,0xF2,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xFE,0x00,
+0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x20,0xF9,0x05,0x05,0x05,0x05,0x0C,0x78,0x09,0x19,0x11,0xB0,0x60,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,
+0x00,0xFF,0x00,0x00,0xF8,0x04,0x02,0x02,0x1F,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x0E,0x2F,0x80,0x7F,0x10,0x10,0xE0,0x00,0x00,0xFF,0x00,
+0x00,0x7F,0x40,0x40,0x43,0x44,0x44,0x44,0x42,0x41,0x42,0x44,0x44,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x4C,0x52,0x51,0x50,0x50,0x48,0x46,0x41,0x40,0x40,0x7F,0x00
+};
+
+static const uint8_t s_stop_white[BLINK_SIZE] = {
+0x00,0xFE,0x02,0x02,0xAA,0x0A,0x2A,0x0A,0x32,0x02,0x7A,0x42,0x52,0x0A,0xF2,0x02,0xF2,0x0A,0x0A,0x0A,0xF2,0x02,0xC2,0x42,0xF2,0x4A,0x4A,0xF2,0x02,0x02,0xFE,0x00,
+0x00,0xFF,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0xC0,0x20,0x10,0x10,0x08,0x09,0x88,0x88,0x09,0x89,0x91,0x10,0x20,0xC1,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0xFF,0x00,
+0x00,0xFF,0x00,0x00,0x00,0x00,0x78,0x86,0x81,0x80,0x40,0x00,0x08,0x08,0x00,0x0E,0x0F,0x20,0x0E,0x0F,0x00,0x88,0x08,0x03,0x84,0x78,0x00,0x00,0x00,0x00,0xFF,0x00,
+0x00,0x7F,0x40,0x40,0x40,0x40,0x4C,0x52,0x51,0x50,0x51,0x51,0x52,0x52,0x54,0x48,0x48,0x58,0x54,0x54,0x52,0x52,0x51,0x51,0x52,0x4C,0x40,0x40,0x40,0x40,0x7F,0x00
+};
+
+// 第 t 次切換時STOP是否為黑色（GO一直是黑色）
+#define BLINK_STOP_STYLE(t)     ((t) & 1 ? LCD_BLIT_INVERT : LCD_BLIT_COPY)
+
+// 原本的 print_C()：clear_LCD()，組成1024位元組緩衝區後 draw_LCD()
+static void blink_copy(uint8_t *buf, const uint8_t *img, int page0, uint8_t invert)
+{
+    int p, x;
+
+    for (p = 0; p < 4; p++)
+        for (x = 0; x < 32; x++)
+            buf[(page0 + p) * LCD_Xmax + BLINK_X + x] = invert ? (uint8_t)~img[p * 32 + x] : img[p * 32 + x];
+}
+
+static void blink_bsp(void)
+{
+    static unsigned char buf[LCD_Xmax * LCD_Ymax / 8];
+    int t;
+
+    init_LCD();
+    clear_LCD();
+    for (t = 0; t <= BLINK_TOGGLES; t++) {
+        clear_LCD();
+        memset(buf, 0, sizeof(buf));
+        blink_copy(buf, s_stop_white, 0, BLINK_STOP_STYLE(t) == LCD_BLIT_INVERT);
+        blink_copy(buf, s_go_white, 4, 1);
+        draw_LCD(buf);
+        if (t == 0) setup_done();               // 第一個畫面不計
+        else frame_done();
+    }
+}
+
+// 目前的 print_C()：兩張圖以 LCD_shadowBlit() 覆蓋，只送出改變的column
+static void blink_shadow(void)
+{
+    int t;
+
+    init_LCD();
+    LCD_shadowInit();
+    for (t = 0; t <= BLINK_TOGGLES; t++) {
+        LCD_shadowBlit(BLINK_X, 0, s_stop_white, 32, 32, BLINK_STOP_STYLE(t));
+        LCD_shadowBlit(BLINK_X, 32, s_go_white, 32, 32, LCD_BLIT_INVERT);
+        LCD_shadowFlush(NULL);
+        if (t == 0) setup_done();
+        else frame_done();
+    }
+}
+
+static const Variant s_blink_variants[] = {
+    { "draw_LCD", 0, blink_bsp    },
+    { "shadow",   1, blink_shadow },
+    { NULL, 0, NULL }
+};
+
+/*
+ * ================================================================
+ * Lab 8 Q2 打磚塊：球8x8每個畫面移動4像素並反彈，擋板16x8跟著球
+ * （代替ADC，每個畫面最多移動4像素），障礙物16x8不動
+ * ================================================================
+ */
+#define BREAKOUT_FRAMES MAX_FRAMES
+
+typedef struct {
+    int x, y, w, h;
+} Box;
+
+static Box s_ball, s_paddle, s_obstacle;
+static int s_ball_dx, s_ball_dy;
+
+static void breakout_init(void)
+{
+    Box ball = { 60, 28, 8, 8 }, paddle = { 56, 56, 16, 8 }, obstacle = { 56, 8, 16, 8 };
+
+    s_ball = ball;
+    s_paddle = paddle;
+    s_obstacle = obstacle;
+    s_ball_dx = 4;
+    s_ball_dy = -4;
+}
+
+// 與 Lab-8/Q2.c 相同的牆壁、擋板、障礙物反彈；擋板一定接到球
+static void breakout_step(void)
+{
+    int target = s_ball.x - 4;
+
+    if (target < s_paddle.x - 4) target = s_paddle.x - 4;
+    if (target > s_paddle.x + 4) target = s_paddle.x + 4;
+    if (target < 0) target = 0;
+    if (target > LCD_Xmax - s_paddle.w) target = LCD_Xmax - s_paddle.w;
+    s_paddle.x = target;
+
+    s_ball.x += s_ball_dx;
+    s_ball.y += s_ball_dy;
+    if (s_ball.x <= 0) { s_ball.x = 0; s_ball_dx = -s_ball_dx; }
+    if (s_ball.x >= LCD_Xmax - s_ball.w) { s_ball.x = LCD_Xmax - s_ball.w; s_ball_dx = -s_ball_dx; }
+    if (s_ball.y <= 0) { s_ball.y = 0; s_ball_dy = -s_ball_dy; }
+    if (s_ball.y + s_ball.h >= s_paddle.y) { s_ball.y = s_paddle.y - s_ball.h; s_ball_dy = -s_ball_dy; }
+    if (s_ball.x < s_obstacle.x + s_obstacle.w && s_ball.x + s_ball.w > s_obstacle.x &&
+        s_ball.y < s_obstacle.y + s_obstacle.h && s_ball.y + s_ball.h > s_obstacle.y) {
+        s_ball_dy = -s_ball_dy;
+        s_ball.y += 2 * s_ball_dy;
+    }
+}
+
+// 原本的 Draw_Game()：clear_LCD() 後以 fill_Rectangle() 畫三個物件
+// （BSP Draw2D.c 的 fill_Rectangle() 對每個像素呼叫一次 draw_Pixel()）
+static void breakout_fill(const Box *b)
+{
+    int x, y;
+
+    for (y = b->y; y < b->y + b->h; y++)
+        for (x = b->x; x < b->x + b->w; x++)
+            draw_Pixel((int16_t)x, (int16_t)y, FG_COLOR, BG_COLOR);
+}
+
+static void breakout_bsp(void)
+{
+    int f;
+
+    init_LCD();
+    clear_LCD();
+    breakout_init();
+    for (f = 0; f <= BREAKOUT_FRAMES; f++) {
+        if (f) breakout_step();
+        clear_LCD();
+        breakout_fill(&s_ball);
+        breakout_fill(&s_paddle);
+        breakout_fill(&s_obstacle);
+        if (f == 0) setup_done();
+        else frame_done();
+    }
+}
+
+// 目前的 Draw_Game()：擦除移動過的物件、重畫三個物件後只送出改變的範圍
+// （LCD_dmaFlush() 送出的字組與 LCD_shadowFlush() 相同，見 LcdDma/）
+static void breakout_erase(const Box *drawn, const Box *b)
+{
+    if (drawn->x == b->x && drawn->y == b->y) return;
+    LCD_shadowFillRect(drawn->x, drawn->y, drawn->x + drawn->w - 1, drawn->y + drawn->h - 1, 0);
+}
+
+static void breakout_shadow(void)
+{
+    Box drawn[3];
+    int f;
+
+    init_LCD();
+    LCD_shadowInit();
+    breakout_init();
+    for (f = 0; f <= BREAKOUT_FRAMES; f++) {
+        if (f) {
+            breakout_step();
+            breakout_erase(&drawn[0], &s_ball);
+            breakout_erase(&drawn[1], &s_paddle);
+            breakout_erase(&drawn[2], &s_obstacle);
+        }
+        drawn[0] = s_ball;
+        drawn[1] = s_paddle;
+        drawn[2] = s_obstacle;
+        LCD_shadowFillRect(s_ball.x, s_ball.y, s_ball.x + s_ball.w - 1, s_ball.y + s_ball.h - 1, 1);
+        LCD_shadowFillRect(s_paddle.x, s_paddle.y, s_paddle.x + s_paddle.w - 1, s_paddle.y + s_paddle.h - 1, 1);
+        LCD_shadowFillRect(s_obstacle.x, s_obstacle.y,
+                           s_obstacle.x + s_obstacle.w - 1, s_obstacle.y + s_obstacle.h - 1, 1);
+        LCD_shadowFlush(NULL);
+        if (f == 0) setup_done();
+        else frame_done();
+    }
+}
+
+static const Variant s_breakout_variants[] = {
+    { "fill_Rect", 0, breakout_bsp    },
+    { "shadow",    1, breakout_shadow },
+    { NULL, 0, NULL }
+};
+
+static const Scenario s_scenarios[] = {
+    { "lab10-walk",   "6 frames x2, 64x64 at x=32",                  s_walk_variants   },
+    { "lab10-keypad", "title + key line, 20 key polls",              s_keypad_variants },
+    { "lab5-log",     "12 attempts, 5 frames each (different fonts)", s_log_variants   },
+    { "lab9-snake16",   "64 ticks, fruit 9 cells ahead",              s_snake16_variants   },
+    { "lab9-snake100",  "64 ticks, fruit 9 cells ahead",              s_snake100_variants  },
+    { "lab9-snake1000", "64 ticks, fruit 9 cells ahead",              s_snake1000_variants },
+    { "lab6-blink",     "64 toggles, STOP white/black, GO black",     s_blink_variants     },
+    { "lab8-breakout",  "64 frames, ball 4 px/frame, paddle follows", s_breakout_variants  },
+};
+#define SCENARIO_COUNT  (sizeof(s_scenarios) / sizeof(s_scenarios[0]))
+
+/*
+ * ================================================================
+ * 主程式
+ * ================================================================
+ */
+int main(int argc, char **argv)
+{
+    const char *filter = NULL;
+    const Variant *v;
+    unsigned i;
+    int a;
+
+    for (a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-s") && a + 1 < argc) filter = argv[++a];
+        else if (!strcmp(argv[a], "-o") && a + 1 < argc) s_out_dir = argv[++a];
+        else {
+            fprintf(stderr, "usage: %s [-s scenario] [-o pbm_dir]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    walk_frames();
+
+    for (i = 0; i < SCENARIO_COUNT; i++) {
+        if (filter && !strstr(s_scenarios[i].name, filter)) continue;
+        s_scenario = s_scenarios[i].name;
+        printf("%s (%s)\n", s_scenarios[i].name, s_scenarios[i].note);
+        printf("  %-10s %6s %8s %8s %8s %9s %8s %8s\n", "variant", "frames",
+               "cmd/f", "addr/f", "data/f", "redund/f", "max data", "px/f");
+
+        for (v = s_scenarios[i].variants; v->name; v++) {
+            s_variant = v->name;
+            s_recording = (v == s_scenarios[i].variants);
+            s_compare = v->compare;
+            memset(&s_sum, 0, sizeof(s_sum));
+            s_max_data = 0;
+
+            lcdEmuReset();
+            v->run();
+
+            printf("  %-10s %6d %8.1f %8.1f %8.1f %9.1f %8lu %8.1f\n", v->name, s_frame,
+                   (double)s_sum.cmds / s_frame, (double)s_sum.addr / s_frame,
+                   (double)s_sum.data / s_frame, (double)s_sum.redundant / s_frame,
+                   (unsigned long)s_max_data, (double)s_sum.changed / s_frame);
+            if (s_sum.unknown) printf("  %-10s %lu unknown commands\n", "", (unsigned long)s_sum.unknown);
+        }
+    }
+
+    if (s_mismatch) printf("FAIL: %lu frames differ\n", s_mismatch);
+    return s_mismatch ? 1 : 0;
+}
@@ -0,0 +1,14 @@
+/*
+ * LCD.h（LcdList替代版）: lcdSetAddr()/lcdWriteData() 由 lcd_list_model.c
+ * 依 LCD.c 的寫法（手動SS0、每個字組等待SPI3完成）實作
+ */
+
+#ifndef __LCD_H__
+#define __LCD_H__
+
+#include <stdint.h>
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+void lcdWriteData(unsigned char temp);
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * ================================================================
+ * NUC100Series.h（LcdList替代版）: 主機端SPI3暫存器與中斷模型
+ * 功能：讓 LCD_List.c 不經修改即可在Linux編譯，SPI3的傳送、
+ *       單次傳送完成中斷都經過 lcd_list_model.c，依虛擬時間逐字組進行
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __NUC100SERIES_H__
+#define __NUC100SERIES_H__
+
+#include <stdint.h>
+
+// ---------------- SPI ----------------
+typedef struct {
+    uint32_t CNTRL;
+    uint32_t DIVIDER;
+    uint32_t SSR;
+    uint32_t RESERVE0;
+    uint32_t RX[2];
+    uint32_t RESERVE1[2];
+    uint32_t TX[2];
+} SPI_T;
+
+extern SPI_T model_spi3;
+#define SPI3    (&model_spi3)
+
+#define SPI_SS0                 0x1u
+#define SPI_SS_ACTIVE_LOW       0x0u
+#define SPI_UNIT_INT_MASK       0x1u
+
+int model_spi_busy(SPI_T *spi);             // 每次讀取都經過一小段虛擬時間
+void model_spi_trigger(SPI_T *spi);         // 開始移出 TX[0]
+void model_spi_clear_flag(SPI_T *spi);
+void SPI_EnableAutoSS(SPI_T *spi, uint32_t ss, uint32_t level);
+void SPI_EnableInt(SPI_T *spi, uint32_t mask);
+void SPI_DisableInt(SPI_T *spi, uint32_t mask);
+
+#define SPI_IS_BUSY(spi)                    model_spi_busy(spi)
+#define SPI_WRITE_TX0(spi, data)            ((spi)->TX[0] = (data))
+#define SPI_TRIGGER(spi)                    model_spi_trigger(spi)
+#define SPI_CLR_UNIT_TRANS_INT_FLAG(spi)    model_spi_clear_flag(spi)
+
+// ---------------- IRQ ----------------
+typedef enum {
+    SPI3_IRQn = 17
+} IRQn_Type;
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+
+#define __DMB()     __asm__ volatile ("" ::: "memory")
+
+#endif
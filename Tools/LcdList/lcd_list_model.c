@@ -0,0 +1,480 @@
+/*
+ * ================================================================
+ * lcd_list_model.c: LCD顯示列表的SPI3中斷模型（Linux主機端）
+ * 功能：以虛擬時間模擬9位元SPI3與單次傳送完成中斷，直接執行
+ *       Library/LCD_List.c，與影子緩衝區的阻塞寫法（LCD_shadowClear()
+ *       後重畫、LCD_shadowFlush()）跑相同的畫面，檢查LCD內容並比較
+ *       主程式等待SPI3的時間與中斷佔用的時間
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：lcdlist [-k SPI3時脈Hz] [-w 每個畫面的運算微秒數] [-i 每次中斷微秒數] [-f 畫面數]
+ * 回傳值：任一情境的LCD內容、SS0或SPI3寫入時機檢查不符時為1
+ *
+ * 模型：
+ * - 每個字組 9 個SPI3時脈；TX0寫入後 SPI_TRIGGER() 開始移出，移出期間SPI_IS_BUSY為1
+ * - 移出完成且中斷已開啟時執行 SPI3_IRQHandler()，每次中斷佔用 -i 指定的CPU時間，
+ *   中斷送出的下一個字組在中斷結束時開始移出；page開始時的繪製不另外計時
+ * - 主程式的運算時間（-w）被中斷佔用的部分會延後完成
+ * - lcdSetAddr()/lcdWriteData() 依 LCD.c 的寫法：手動拉低SS0、寫入、
+ *   等待SPI3完成、拉高SS0
+ * - 字組在SS0未致能時送出、或SPI3移出中又觸發，都算錯誤
+ * - 列表模式每 CHECK_EVERY 個畫面與最後等待 LCD_listWait() 後，LCD內容必須與
+ *   最後一個畫面以影子緩衝區重畫的結果相同
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "LCD.h"
+#include "LCD_Shadow.h"
+#include "LCD_Font5x7.h"
+#include "LCD_List.h"
+
+#define POLL_NS         100         // 讀取一次SPI_IS_BUSY的時間
+#define PANEL_COLUMNS   132
+#define CHECK_EVERY     37          // 列表模式每隔幾個畫面等待並檢查一次
+
+extern void SPI3_IRQHandler(void);
+
+// ================================================================
+// SPI3與虛擬LCD
+// ================================================================
+SPI_T model_spi3;
+
+static uint64_t s_now = 0;          // 虛擬時間（奈秒）
+static uint32_t s_word_ns;          // 一個字組的移出時間
+static uint32_t s_isr_ns;           // 一次中斷佔用的CPU時間
+static uint64_t s_shift_end = 0;
+static int s_shifting = 0;
+static int s_flag = 0;              // 單次傳送完成旗標
+static int s_int_enabled = 0;       // SPI_EnableInt(SPI_UNIT_INT_MASK)
+static int s_nvic = 0;
+static int s_manual_ss = 0;         // LCD.c 手動拉低SS0
+static int s_auto_ss = 0;           // SPI_EnableAutoSS()
+
+static unsigned long s_errors = 0;
+static unsigned long s_isr_count = 0;
+static uint64_t s_isr_total = 0;    // 中斷佔用的CPU時間
+static long s_words = 0;
+
+static uint8_t s_panel[LCD_SHADOW_PAGES][PANEL_COLUMNS];
+static uint8_t s_page, s_col;
+
+static void error(const char *what)
+{
+    if (s_errors < 5) fprintf(stderr, "lcdlist: %s at %.3f ms\n", what, s_now / 1e6);
+    s_errors++;
+}
+
+// LCD控制器：解讀命令與資料，資料寫入後column自動加1
+static void decode(uint16_t w)
+{
+    if (w & 0x100) {
+        if (s_page < LCD_SHADOW_PAGES && s_col < PANEL_COLUMNS) s_panel[s_page][s_col] = (uint8_t)w;
+        s_col++;
+    } else if ((w & 0xF0) == 0xB0) {
+        s_page = w & 0x0F;
+    } else if ((w & 0xF0) == 0x10) {
+        s_col = (uint8_t)((s_col & 0x0F) | ((w & 0x0F) << 4));
+    } else if ((w & 0xF0) == 0x00) {
+        s_col = (uint8_t)((s_col & 0xF0) | (w & 0x0F));
+    }
+}
+
+static void spi_send(uint16_t w)
+{
+    if (s_shifting) error("SPI3 triggered while busy");
+    if (!s_manual_ss && !s_auto_ss) error("word sent with SS0 inactive");
+    s_words++;
+    decode(w);
+    s_shifting = 1;
+    s_shift_end = s_now + s_word_ns;
+}
+
+// 目前的字組移出完成：設定旗標，中斷開啟時執行中斷服務程式
+static void finish_word(void)
+{
+    s_now = s_shift_end;
+    s_shifting = 0;
+    s_flag = 1;
+    if (s_int_enabled && s_nvic) {
+        s_now += s_isr_ns;
+        s_isr_total += s_isr_ns;
+        s_isr_count++;
+        SPI3_IRQHandler();
+        if (s_flag) error("SPI3 interrupt flag not cleared");
+    }
+}
+
+// 虛擬時間前進到 t（CPU等待中，期間發生的中斷照常執行）
+static void advance_to(uint64_t t)
+{
+    while (s_shifting && s_shift_end <= t) finish_word();
+    if (t > s_now) s_now = t;
+}
+
+// 主程式運算 ns：被中斷佔用的時間不算在運算內
+static void cpu_work(uint64_t ns)
+{
+    uint64_t used;
+
+    while (s_shifting && s_shift_end < s_now + ns) {
+        used = s_shift_end - s_now;
+        ns -= used;
+        finish_word();
+    }
+    s_now += ns;
+}
+
+// ---------------- BSP函式 ----------------
+int model_spi_busy(SPI_T *spi)
+{
+    (void)spi;
+    advance_to(s_now + POLL_NS);
+    return s_shifting;
+}
+
+void model_spi_trigger(SPI_T *spi)
+{
+    spi_send((uint16_t)spi->TX[0]);
+}
+
+void model_spi_clear_flag(SPI_T *spi)
+{
+    (void)spi;
+    s_flag = 0;
+}
+
+void SPI_EnableAutoSS(SPI_T *spi, uint32_t ss, uint32_t level)
+{
+    (void)spi;
+    if (ss != SPI_SS0 || level != SPI_SS_ACTIVE_LOW) error("LCD SS must be SS0 active low");
+    s_auto_ss = 1;
+}
+
+void SPI_EnableInt(SPI_T *spi, uint32_t mask)
+{
+    (void)spi;
+    if (mask & SPI_UNIT_INT_MASK) s_int_enabled = 1;
+}
+
+void SPI_DisableInt(SPI_T *spi, uint32_t mask)
+{
+    (void)spi;
+    if (mask & SPI_UNIT_INT_MASK) s_int_enabled = 0;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if (irq == SPI3_IRQn) s_nvic = 1;
+}
+
+// ---------------- LCD.c（阻塞寫法）----------------
+static void lcd_word(uint16_t w)
+{
+    s_auto_ss = 0;                  // SPI_SET_SS0_LOW() 會關閉自動SS
+    s_manual_ss = 1;
+    spi_send(w);
+    while (SPI_IS_BUSY(SPI3));
+    s_manual_ss = 0;
+}
+
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr)
+{
+    lcd_word(0xB0 | PageAddr);
+    lcd_word(0x10 | ((ColumnAddr >> 4) & 0xF));
+    lcd_word(0x00 | (ColumnAddr & 0xF));
+}
+
+void lcdWriteData(unsigned char temp)
+{
+    lcd_word(0x100 + temp);
+}
+
+// ================================================================
+// 繪圖目的地：同一個情境畫到影子緩衝區或顯示列表
+// ================================================================
+static int s_to_list = 0;
+
+static void fill_rect(int x0, int y0, int x1, int y1, uint8_t color)
+{
+    if (s_to_list) LCD_listFillRect(x0, y0, x1, y1, color);
+    LCD_shadowFillRect(x0, y0, x1, y1, color);
+}
+
+static void invert_rect(int x0, int y0, int x1, int y1)
+{
+    if (s_to_list) LCD_listInvertRect(x0, y0, x1, y1);
+    LCD_shadowInvertRect(x0, y0, x1, y1);
+}
+
+static void circle(int xc, int yc, int r, uint8_t color)
+{
+    if (s_to_list) LCD_listCircle(xc, yc, r, color);
+    LCD_shadowCircle(xc, yc, r, color);
+}
+
+static void blit(int x, int y, const uint8_t *bmp, uint8_t w, uint8_t h, uint8_t mode)
+{
+    if (s_to_list) LCD_listBlit(x, y, bmp, w, h, mode);
+    LCD_shadowBlit(x, y, bmp, w, h, mode);
+}
+
+static void print_char(int x, int y, char c)
+{
+    if (s_to_list) LCD_listChar(x, y, c);
+    LCD_shadowBlit(x, y, LCD_font5x7Glyph(c), LCD_FONT5X7_W, LCD_FONT5X7_H, LCD_BLIT_COPY);
+}
+
+// ================================================================
+// 情境：每個畫面描述整個畫面
+// ================================================================
+// Lab 8 Q1 數字競賽：4個數字依速度右移，到終點後重新開始
+static void race(int frame)
+{
+    static int x[4], speed[4] = { 8, 2, 6, 4 };
+    static const char num[4] = { '9', '2', '7', '5' };
+    int i, done = 1;
+
+    for (i = 0; i < 4; i++) {
+        if (frame == 0) x[i] = 0;
+        else if (x[i] < 122) x[i] = (x[i] + speed[i] > 122) ? 122 : x[i] + speed[i];
+        if (x[i] < 122) done = 0;
+    }
+    for (i = 0; i < 4; i++) print_char(x[i], i * 16, num[i]);
+    if (done) x[0] = x[1] = x[2] = x[3] = 0;
+}
+
+// Lab 7 Q2：兩個5x5方塊與半徑3的球
+static void ball(int frame)
+{
+    static int bx, by, dx, dy, visible;
+
+    if (frame == 0) {
+        bx = 64;
+        by = 60;
+        dx = 3;
+        dy = -3;
+        visible = 3;
+    }
+    bx += dx;
+    by += dy;
+    if (bx <= 3 || bx >= 124) dx = -dx;
+    if (by <= 3 || by >= 60) dy = -dy;
+    if (frame % 40 == 20) visible &= ~(1 << (rand() % 2));
+    if (frame % 40 == 0) visible = 3;
+
+    if (visible & 1) fill_rect(20 - 2, 12 - 2, 20 + 2, 12 + 2, 1);
+    if (visible & 2) fill_rect(90 - 2, 22 - 2, 90 + 2, 22 + 2, 1);
+    circle(bx, by, 3, 1);
+}
+
+// Lab 8 Q2 打磚塊：球、擋板、障礙物
+static void breakout(int frame)
+{
+    static int bx, by, dx, dy, px;
+
+    if (frame == 0) {
+        bx = 60;
+        by = 28;
+        dx = 4;
+        dy = 4;
+        px = 56;
+    }
+    bx += dx;
+    by += dy;
+    if (bx <= 0 || bx >= 120) dx = -dx;
+    if (by <= 0 || by >= 48) dy = -dy;
+    px += (rand() % 9) - 4;
+    if (px < 0) px = 0;
+    if (px > 112) px = 112;
+
+    fill_rect(bx, by, bx + 7, by + 7, 1);
+    fill_rect(px, 56, px + 15, 63, 1);
+    fill_rect(56, 8, 71, 15, 1);
+}
+
+// 所有命令與模式、任意位置（含超出畫面）
+static void mixed(int frame)
+{
+    static uint8_t img[4][40 * 5];
+    static const char text[] = "LCD list 0123456789 !?";
+    static unsigned seed;
+    int i, n;
+
+    if (frame == 0) {
+        for (i = 0; i < (int)sizeof(img); i++) ((uint8_t *)img)[i] = (uint8_t)rand();
+    }
+    if (frame % 4 != 3) seed = (unsigned)rand();    // 每4個畫面有一個與上一個相同
+    srand(seed);
+
+    n = 3 + rand() % 10;
+    for (i = 0; i < n; i++) {
+        switch (rand() % 5) {
+        case 0:
+            fill_rect(rand() % 160 - 16, rand() % 80 - 8, rand() % 160 - 16, rand() % 80 - 8, (uint8_t)(rand() & 1));
+            break;
+        case 1:
+            invert_rect(rand() % 160 - 16, rand() % 80 - 8, rand() % 160 - 16, rand() % 80 - 8);
+            break;
+        case 2:
+            circle(rand() % 160 - 16, rand() % 80 - 8, rand() % 30, (uint8_t)(rand() & 1));
+            break;
+        case 3:
+            blit(rand() % 180 - 40, rand() % 100 - 36, img[rand() % 4], (uint8_t)(1 + rand() % 40),
+                 (uint8_t)(1 + rand() % 36), (uint8_t)(rand() % 5));
+            break;
+        default:
+            print_char(rand() % 140 - 6, rand() % 72 - 6, text[rand() % (sizeof(text) - 1)]);
+            break;
+        }
+    }
+}
+
+typedef struct {
+    const char *name;
+    void (*draw)(int frame);
+} Scenario;
+
+static const Scenario s_scenarios[] = {
+    { "lab8-race",     race },
+    { "lab7-ball",     ball },
+    { "lab8-breakout", breakout },
+    { "mixed",         mixed },
+};
+
+// ================================================================
+// 執行
+// ================================================================
+typedef struct {
+    long words;             // 畫面送出的字組數
+    uint64_t wait_ns;       // 主程式等待SPI3的時間
+    uint64_t isr_ns;        // 中斷佔用的時間
+    unsigned long isr;      // 中斷次數
+    LcdListStats stats;
+    int ok;
+} Result;
+
+static void reset_model(void)
+{
+    memset(&model_spi3, 0, sizeof(model_spi3));
+    memset(s_panel, 0, sizeof(s_panel));
+    s_now = 0;
+    s_shifting = s_flag = s_int_enabled = s_nvic = 0;
+    s_manual_ss = s_auto_ss = 0;
+    s_page = s_col = 0;
+    s_words = 0;
+    s_isr_count = 0;
+    s_isr_total = 0;
+}
+
+// LCD內容是否與影子緩衝區相同（x 對應 column 129-x）
+static int panel_matches(void)
+{
+    int page, x;
+
+    for (page = 0; page < LCD_SHADOW_PAGES; page++) {
+        for (x = 0; x < LCD_SHADOW_WIDTH; x++) {
+            if (s_panel[page][LCD_SHADOW_WIDTH + 1 - x] != LCD_shadowRead((uint8_t)page, (uint8_t)x)) return 0;
+        }
+    }
+    return 1;
+}
+
+static void run(const Scenario *scn, int to_list, int frames, uint64_t work_ns, Result *r)
+{
+    long start;
+    uint64_t t0;
+    int f;
+
+    reset_model();
+    memset(r, 0, sizeof(*r));
+    r->ok = 1;
+    srand(12345);
+    s_to_list = to_list;
+
+    LCD_shadowInit();                   // 清除畫面（clear_LCD()）
+    if (to_list) LCD_listInit();
+    start = s_words;
+
+    for (f = 0; f < frames; f++) {
+        cpu_work(work_ns);              // 遊戲運算（列表模式下中斷同時送出）
+        LCD_shadowClear();
+        if (to_list) LCD_listBegin();
+        scn->draw(f);
+        t0 = s_now;
+        if (to_list) {
+            LCD_listSubmit();
+        } else {
+            LCD_shadowFlush(NULL);
+        }
+        r->wait_ns += s_now - t0;
+
+        if (to_list && f % CHECK_EVERY == CHECK_EVERY - 1) {
+            LCD_listWait();
+            if (!panel_matches()) r->ok = 0;
+        }
+    }
+    if (to_list) {
+        LCD_listWait();
+        LCD_listStats(&r->stats);
+    }
+    if (!panel_matches()) r->ok = 0;
+    r->words = s_words - start;
+    r->isr = s_isr_count;
+    r->isr_ns = s_isr_total;
+
+    // 之後直接使用SPI3（如 GAME OVER 畫面）：LCD_listWait() 返回時傳送必須已經結束
+    LCD_shadowInvalidate();
+    LCD_shadowFlush(NULL);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long spi_hz = 1000000;
+    unsigned long work_us = 1000;
+    unsigned long isr_ns = 2000;
+    int frames = 500, i, n, fail = 0;
+    Result block, list;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) spi_hz = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) work_us = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) isr_ns = (unsigned long)(atof(argv[++i]) * 1000);
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: lcdlist [-k spi_hz] [-w work_us] [-i isr_us] [-f frames]\n");
+            return 1;
+        }
+    }
+    if (spi_hz == 0 || frames <= 0) return 1;
+    s_word_ns = (uint32_t)(9ULL * 1000000000ULL / spi_hz);
+    s_isr_ns = (uint32_t)isr_ns;
+
+    printf("SPI3 %lu Hz (%.1f us/word), %lu us of work per frame, %.1f us per interrupt, %d frames\n\n",
+           spi_hz, s_word_ns / 1000.0, work_us, s_isr_ns / 1000.0, frames);
+    printf("%-14s %9s %9s %11s %9s %9s %17s  %s\n", "scenario", "blk w/frm", "list w/fr",
+           "blocking us", "list us", "isr us", "shown/same/drop", "check");
+
+    n = (int)(sizeof(s_scenarios) / sizeof(s_scenarios[0]));
+    for (i = 0; i < n; i++) {
+        run(&s_scenarios[i], 0, frames, work_us * 1000ULL, &block);
+        run(&s_scenarios[i], 1, frames, work_us * 1000ULL, &list);
+        list.ok = list.ok && block.ok && s_errors == 0 &&
+                  list.stats.submitted == (uint32_t)frames &&
+                  list.stats.shown + list.stats.same + list.stats.dropped == list.stats.submitted &&
+                  list.isr == (unsigned long)list.words;
+
+        printf("%-14s %9.1f %9.1f %11.1f %9.1f %9.1f %7lu/%4lu/%4lu  %s\n", s_scenarios[i].name,
+               (double)block.words / frames, (double)list.words / frames,
+               block.wait_ns / 1000.0 / frames, list.wait_ns / 1000.0 / frames,
+               list.isr_ns / 1000.0 / frames,
+               (unsigned long)list.stats.shown, (unsigned long)list.stats.same,
+               (unsigned long)list.stats.dropped, list.ok ? "panel ok" : "MISMATCH");
+        if (!list.ok) fail = 1;
+    }
+    if (s_errors) printf("\n%lu SPI3 errors\n", s_errors);
+    return fail;
+}
@@ -0,0 +1,8 @@
+/*
+ * Draw2D.h（MemMap替代版）: Lab 10 未使用繪圖函式，保持空白
+ */
+
+#ifndef __DRAW2D_H__
+#define __DRAW2D_H__
+
+#endif
@@ -0,0 +1,22 @@
+/*
+ * LCD.h（MemMap替代版）: 與BSP相同的LCD函式宣告
+ */
+
+#ifndef __LCD_H__
+#define __LCD_H__
+
+#include <stdint.h>
+
+#define FG_COLOR 0xFFFF
+#define BG_COLOR 0x0000
+
+void init_LCD(void);
+void clear_LCD(void);
+void print_Line(int8_t line, char text[]);
+void draw_LCD(unsigned char *buffer);
+void draw_Pixel(int16_t x, int16_t y, uint16_t fgColor, uint16_t bgColor);
+void draw_Bmp64x64(int16_t x, int16_t y, uint16_t fgColor, uint16_t bgColor, unsigned char bitmap[]);
+void lcdSetAddr(uint8_t PageAddr, uint8_t ColumnAddr);
+void lcdWriteData(unsigned char temp);
+
+#endif
@@ -0,0 +1,8 @@
+/*
+ * MCU_init.h（MemMap替代版）: 時脈設定不影響記憶體配置，保持空白
+ */
+
+#ifndef __MCU_INIT_H__
+#define __MCU_INIT_H__
+
+#endif
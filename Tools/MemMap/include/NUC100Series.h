@@ -0,0 +1,59 @@
+/*
+ * ================================================================
+ * NUC100Series.h（MemMap替代版）: 只供主機端編譯出物件檔
+ * 功能：Lab 的韌體原始碼不經修改即可以 gcc -c 編譯，再由 memmap
+ *       讀取各區段大小；程式不會被執行，暫存器都對應到同一個陣列
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __NUC100SERIES_H__
+#define __NUC100SERIES_H__
+
+#include <stdint.h>
+
+extern volatile uint32_t mm_reg[16];
+
+// ---------------- GPIO ----------------
+#define PA          ((void *)&mm_reg[0])
+#define PB          ((void *)&mm_reg[1])
+#define PA12        mm_reg[2]
+#define PA13        mm_reg[3]
+#define PA14        mm_reg[4]
+#define PB11        mm_reg[5]
+
+#define BIT11       0x00000800u
+#define BIT12       0x00001000u
+#define BIT13       0x00002000u
+#define BIT14       0x00004000u
+
+#define GPIO_PMD_OUTPUT         0x1u
+
+void GPIO_SetMode(void *port, uint32_t mask, uint32_t mode);
+
+// ---------------- TIMER ----------------
+#define TIMER0      ((void *)&mm_reg[8])
+#define TIMER1      ((void *)&mm_reg[9])
+
+#define TMR0_MODULE             0
+#define TMR1_MODULE             1
+#define CLK_CLKSEL1_TMR0_S_HXT  0
+#define CLK_CLKSEL1_TMR1_S_HXT  0
+#define TIMER_PERIODIC_MODE     1
+
+void CLK_EnableModuleClock(uint32_t module);
+void CLK_SetModuleClock(uint32_t module, uint32_t src, uint32_t div);
+void CLK_SysTickDelay(uint32_t us);
+uint32_t TIMER_Open(void *timer, uint32_t mode, uint32_t hz);
+void TIMER_EnableInt(void *timer);
+void TIMER_Start(void *timer);
+void TIMER_ClearIntFlag(void *timer);
+
+// ---------------- IRQ ----------------
+#define TMR0_IRQn   8
+#define TMR1_IRQn   9
+
+void NVIC_EnableIRQ(int irq);
+void NVIC_SetPriority(int irq, uint32_t priority);
+
+#endif
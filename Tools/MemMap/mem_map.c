@@ -0,0 +1,316 @@
+/*
+ * ================================================================
+ * mem_map.c: 物件檔記憶體配置報告（Linux主機端）
+ * 功能：讀取ELF物件檔/執行檔（主機gcc的 .o，或Keil的 .o/.axf），
+ *       依區段屬性統計flash與SRAM用量，列出佔用SRAM的變數，
+ *       並比較修改前後兩個檔案的差異
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：memmap [-s] 檔案 ...          每個檔案一列；-s 另外列出各檔案的SRAM變數
+ *       memmap -d 修改前 修改後       逐一列出區段或大小改變的變數
+ * 回傳值：讀檔失敗，或 -d 模式下修改後的SRAM用量比修改前多時為1
+ *
+ * 區段依屬性分類（不看名稱，Keil 的 ER_RO/ER_RW/ER_ZI 也適用）：
+ *   可執行          -> 程式碼（flash）
+ *   唯讀            -> 唯讀資料（flash）
+ *   可寫、有內容    -> 初始化資料：flash存初始值，開機時複製到SRAM
+ *   可寫、無內容    -> 零初始化（只佔SRAM，開機時清為0）
+ * 主機編譯的程式碼大小與Cortex-M0不同，只有資料部分可以直接對照；
+ * 以 -fno-pic 編譯，否則指標表格會被放到可寫的 .data.rel.ro
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_SYMBOLS     4096
+#define NAME_LEN        64
+
+// 區段分類
+enum { SEC_NONE, SEC_TEXT, SEC_RODATA, SEC_DATA, SEC_BSS, SEC_CLASSES };
+
+static const char *s_class_name[SEC_CLASSES] = { "-", "text", "rodata", "data", "bss" };
+
+// ELF常數（只用到的部分）
+#define SHT_SYMTAB      2
+#define SHT_NOBITS      8
+#define SHF_WRITE       0x1
+#define SHF_ALLOC       0x2
+#define SHF_EXECINSTR   0x4
+#define SHN_LORESERVE   0xFF00
+#define SHN_COMMON      0xFFF2
+#define STT_OBJECT      1
+
+typedef struct {
+    char name[NAME_LEN];
+    uint8_t cls;
+    unsigned long size;
+} Symbol;
+
+typedef struct {
+    const char *path;
+    unsigned long total[SEC_CLASSES];
+    Symbol sym[MAX_SYMBOLS];
+    int count;
+} Layout;
+
+// ================================================================
+// ELF讀取（32/64位元，little-endian）
+// ================================================================
+static const uint8_t *s_elf;
+static long s_elf_size;
+static int s_is64;
+
+static unsigned long rd(long off, int n)
+{
+    unsigned long v = 0;
+    int i;
+
+    if (off < 0 || off + n > s_elf_size) return 0;
+    for (i = n - 1; i >= 0; i--) v = (v << 8) | s_elf[off + i];
+    return v;
+}
+
+// 欄位寬度隨ELF類別不同
+#define ADDR_BYTES      (s_is64 ? 8 : 4)
+
+static uint8_t section_class(long sh)
+{
+    unsigned long type = rd(sh + 4, 4);
+    unsigned long flags = rd(sh + 8, ADDR_BYTES);
+
+    if (!(flags & SHF_ALLOC)) return SEC_NONE;
+    if (flags & SHF_EXECINSTR) return SEC_TEXT;
+    if (!(flags & SHF_WRITE)) return SEC_RODATA;
+    return type == SHT_NOBITS ? SEC_BSS : SEC_DATA;
+}
+
+static void add_symbol(Layout *l, const char *name, uint8_t cls, unsigned long size)
+{
+    Symbol *s;
+
+    if (l->count >= MAX_SYMBOLS || size == 0) return;
+    s = &l->sym[l->count++];
+    strncpy(s->name, name, NAME_LEN - 1);
+    s->name[NAME_LEN - 1] = '\0';
+    s->cls = cls;
+    s->size = size;
+}
+
+static int parse_elf(Layout *l)
+{
+    long shoff, sh, symoff, stroff, symsize, entsize, e;
+    unsigned shentsize, shnum, shndx, i;
+    uint8_t cls[SHN_LORESERVE];
+    unsigned long info, size;
+
+    if (s_elf_size < 52 || memcmp(s_elf, "\177ELF", 4) != 0) return -1;
+    if (s_elf[5] != 1) return -2;                   // 只支援little-endian
+    s_is64 = (s_elf[4] == 2);
+
+    shoff = (long)rd(s_is64 ? 0x28 : 0x20, ADDR_BYTES);
+    shentsize = (unsigned)rd(s_is64 ? 0x3A : 0x2E, 2);
+    shnum = (unsigned)rd(s_is64 ? 0x3C : 0x30, 2);
+    if (shoff == 0 || shnum == 0 || shnum >= SHN_LORESERVE) return -1;
+
+    // 各區段大小
+    for (i = 0; i < shnum; i++) {
+        sh = shoff + (long)i * shentsize;
+        cls[i] = section_class(sh);
+        l->total[cls[i]] += rd(sh + (s_is64 ? 0x20 : 0x14), ADDR_BYTES);
+    }
+
+    // 符號表：只取變數（STT_OBJECT）
+    for (i = 0; i < shnum; i++) {
+        sh = shoff + (long)i * shentsize;
+        if (rd(sh + 4, 4) != SHT_SYMTAB) continue;
+        symoff = (long)rd(sh + (s_is64 ? 0x18 : 0x10), ADDR_BYTES);
+        symsize = (long)rd(sh + (s_is64 ? 0x20 : 0x14), ADDR_BYTES);
+        entsize = (long)rd(sh + (s_is64 ? 0x38 : 0x24), ADDR_BYTES);
+        stroff = (long)rd(shoff + (long)rd(sh + (s_is64 ? 0x28 : 0x18), 4) * shentsize
+                          + (s_is64 ? 0x18 : 0x10), ADDR_BYTES);
+        if (entsize == 0) continue;
+
+        for (e = symoff; e + entsize <= symoff + symsize; e += entsize) {
+            unsigned long name = rd(e, 4);
+            info = rd(e + (s_is64 ? 4 : 12), 1);
+            shndx = (unsigned)rd(e + (s_is64 ? 6 : 14), 2);
+            size = rd(e + (s_is64 ? 16 : 8), ADDR_BYTES);
+            if ((info & 0x0F) != STT_OBJECT || stroff + (long)name >= s_elf_size) continue;
+
+            if (shndx == SHN_COMMON) {
+                // 未初始化的共用定義（-fcommon / 舊版編譯器）
+                add_symbol(l, (const char *)s_elf + stroff + name, SEC_BSS, size);
+                l->total[SEC_BSS] += size;
+            } else if (shndx != 0 && shndx < shnum && cls[shndx] != SEC_NONE) {
+                add_symbol(l, (const char *)s_elf + stroff + name, cls[shndx], size);
+            }
+        }
+    }
+    return 0;
+}
+
+static int load(Layout *l, const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf;
+    int rc;
+
+    memset(l, 0, sizeof(*l));
+    l->path = path;
+    if (!f) {
+        fprintf(stderr, "memmap: cannot open %s\n", path);
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    s_elf_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(s_elf_size > 0 ? (size_t)s_elf_size : 1);
+    if (!buf || fread(buf, 1, (size_t)s_elf_size, f) != (size_t)s_elf_size) {
+        fprintf(stderr, "memmap: cannot read %s\n", path);
+        fclose(f);
+        free(buf);
+        return -1;
+    }
+    fclose(f);
+
+    s_elf = buf;
+    rc = parse_elf(l);
+    free(buf);
+    if (rc == -2) fprintf(stderr, "memmap: %s: big-endian ELF is not supported\n", path);
+    else if (rc < 0) fprintf(stderr, "memmap: %s: not an ELF file\n", path);
+    return rc;
+}
+
+// ================================================================
+// 報告
+// ================================================================
+static unsigned long flash_bytes(const Layout *l)
+{
+    return l->total[SEC_TEXT] + l->total[SEC_RODATA] + l->total[SEC_DATA];
+}
+
+static unsigned long sram_bytes(const Layout *l)
+{
+    return l->total[SEC_DATA] + l->total[SEC_BSS];
+}
+
+static void print_header(void)
+{
+    printf("%8s %8s %8s %8s | %8s %8s  %s\n",
+           "text", "rodata", "data", "bss", "flash", "SRAM", "file");
+}
+
+static void print_row(const Layout *l)
+{
+    printf("%8lu %8lu %8lu %8lu | %8lu %8lu  %s\n",
+           l->total[SEC_TEXT], l->total[SEC_RODATA], l->total[SEC_DATA], l->total[SEC_BSS],
+           flash_bytes(l), sram_bytes(l), l->path);
+}
+
+static int by_size(const void *a, const void *b)
+{
+    const Symbol *x = a, *y = b;
+    if (x->size != y->size) return x->size < y->size ? 1 : -1;
+    return strcmp(x->name, y->name);
+}
+
+static void print_sram_symbols(Layout *l)
+{
+    int i;
+
+    qsort(l->sym, (size_t)l->count, sizeof(Symbol), by_size);
+    printf("\n%s: SRAM variables\n", l->path);
+    for (i = 0; i < l->count; i++) {
+        if (l->sym[i].cls != SEC_DATA && l->sym[i].cls != SEC_BSS) continue;
+        printf("  %-6s %6lu  %s\n", s_class_name[l->sym[i].cls], l->sym[i].size, l->sym[i].name);
+    }
+}
+
+static const Symbol *find(const Layout *l, const char *name)
+{
+    int i;
+    for (i = 0; i < l->count; i++) {
+        if (strcmp(l->sym[i].name, name) == 0) return &l->sym[i];
+    }
+    return NULL;
+}
+
+static void print_change(const char *name, const Symbol *a, const Symbol *b)
+{
+    printf("  %-24s %6s %6lu -> %-6s %6lu\n", name,
+           a ? s_class_name[a->cls] : "-", a ? a->size : 0UL,
+           b ? s_class_name[b->cls] : "-", b ? b->size : 0UL);
+}
+
+static void print_diff(Layout *a, Layout *b)
+{
+    const Symbol *s, *t;
+    int i;
+
+    print_header();
+    print_row(a);
+    print_row(b);
+    printf("flash %+ld bytes, SRAM %+ld bytes, startup copy %lu -> %lu bytes\n",
+           (long)flash_bytes(b) - (long)flash_bytes(a),
+           (long)sram_bytes(b) - (long)sram_bytes(a),
+           a->total[SEC_DATA], b->total[SEC_DATA]);
+
+    qsort(a->sym, (size_t)a->count, sizeof(Symbol), by_size);
+    qsort(b->sym, (size_t)b->count, sizeof(Symbol), by_size);
+    printf("\nchanged variables (section size -> section size)\n");
+    for (i = 0; i < a->count; i++) {
+        s = &a->sym[i];
+        t = find(b, s->name);
+        if (!t || t->cls != s->cls || t->size != s->size) print_change(s->name, s, t);
+    }
+    for (i = 0; i < b->count; i++) {
+        if (!find(a, b->sym[i].name)) print_change(b->sym[i].name, NULL, &b->sym[i]);
+    }
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: memmap [-s] file ...\n"
+                    "       memmap -d before after\n");
+}
+
+static Layout s_layout[2];
+
+int main(int argc, char **argv)
+{
+    int i, list = 0, rc = 0;
+
+    if (argc > 1 && strcmp(argv[1], "-d") == 0) {
+        if (argc != 4) {
+            usage();
+            return 1;
+        }
+        if (load(&s_layout[0], argv[2]) < 0 || load(&s_layout[1], argv[3]) < 0) return 1;
+        print_diff(&s_layout[0], &s_layout[1]);
+        return sram_bytes(&s_layout[1]) > sram_bytes(&s_layout[0]) ? 1 : 0;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "-s") == 0) {
+        list = 1;
+        argv++;
+        argc--;
+    }
+    if (argc < 2) {
+        usage();
+        return 1;
+    }
+
+    print_header();
+    for (i = 1; i < argc; i++) {
+        if (load(&s_layout[0], argv[i]) < 0) {
+            rc = 1;
+            continue;
+        }
+        print_row(&s_layout[0]);
+        if (list) print_sram_symbols(&s_layout[0]);
+    }
+    return rc;
+}
@@ -0,0 +1,17 @@
+/*
+ * GPIO.h（SegEmu替代版）: GPIO_SetMode 只計為一次周邊存取
+ */
+
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#include "NUC100Series.h"
+
+#define GPIO_PMD_INPUT          0x0u
+#define GPIO_PMD_OUTPUT         0x1u
+#define GPIO_PMD_OPEN_DRAIN     0x2u
+#define GPIO_PMD_QUASI          0x3u
+
+#define GPIO_SetMode(port, mask, mode)  ((void)(port), (void)(mask), (void)(mode))
+
+#endif
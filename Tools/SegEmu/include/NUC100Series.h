@@ -0,0 +1,79 @@
+/*
+ * ================================================================
+ * NUC100Series.h（SegEmu替代版）: 主機端模擬用的最小暫存器定義
+ * 功能：讓 Seven_Segment.c、Segment_Scan.c 等韌體原始碼不經修改即可在Linux編譯，
+ *       所有 PC/PE 暫存器與 PDIO 存取都會經過 seg_emu.c 記錄時間
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#ifndef __NUC100SERIES_H__
+#define __NUC100SERIES_H__
+
+#include <stdint.h>
+#include "seg_emu.h"
+
+// ---------------- GPIO ----------------
+typedef struct {
+    uint32_t PMD;
+    uint32_t OFFD;
+    uint32_t DOUT;
+    uint32_t DMASK;
+    uint32_t PIN;
+    uint32_t DBEN;
+    uint32_t IMD;
+    uint32_t IEN;
+    uint32_t ISRC;
+} GPIO_T;
+
+#define PC  ((GPIO_T *)emu_port(EMU_PORT_C))
+#define PE  ((GPIO_T *)emu_port(EMU_PORT_E))
+
+#define PC4 (*emu_pdio(EMU_PORT_C, 4))
+#define PC5 (*emu_pdio(EMU_PORT_C, 5))
+#define PC6 (*emu_pdio(EMU_PORT_C, 6))
+#define PC7 (*emu_pdio(EMU_PORT_C, 7))
+#define PE0 (*emu_pdio(EMU_PORT_E, 0))
+#define PE1 (*emu_pdio(EMU_PORT_E, 1))
+#define PE2 (*emu_pdio(EMU_PORT_E, 2))
+#define PE3 (*emu_pdio(EMU_PORT_E, 3))
+#define PE4 (*emu_pdio(EMU_PORT_E, 4))
+#define PE5 (*emu_pdio(EMU_PORT_E, 5))
+#define PE6 (*emu_pdio(EMU_PORT_E, 6))
+#define PE7 (*emu_pdio(EMU_PORT_E, 7))
+
+#define BIT0    0x00000001u
+#define BIT1    0x00000002u
+#define BIT2    0x00000004u
+#define BIT3    0x00000008u
+#define BIT4    0x00000010u
+#define BIT5    0x00000020u
+#define BIT6    0x00000040u
+#define BIT7    0x00000080u
+
+// ---------------- TIMER ----------------
+typedef struct {
+    uint32_t TCSR;
+    uint32_t TCMPR;
+    uint32_t TISR;
+    uint32_t TDR;
+} TIMER_T;
+
+extern TIMER_T emu_timer_regs[EMU_TIMERS];
+#define TIMER0  (&emu_timer_regs[0])
+#define TIMER1  (&emu_timer_regs[1])
+#define TIMER2  (&emu_timer_regs[2])
+#define TIMER3  (&emu_timer_regs[3])
+
+// ---------------- IRQ ----------------
+typedef enum {
+    TMR0_IRQn = 8,
+    TMR1_IRQn = 9,
+    TMR2_IRQn = 10,
+    TMR3_IRQn = 11
+} IRQn_Type;
+
+#define NVIC_EnableIRQ(irq)     ((void)(irq))
+#define NVIC_DisableIRQ(irq)    ((void)(irq))
+
+#endif
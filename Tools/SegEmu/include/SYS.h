@@ -0,0 +1,30 @@
+/*
+ * SYS.h（SegEmu替代版）: 時脈、延遲與計時器函式對應到虛擬時脈
+ */
+
+#ifndef __SYS_H__
+#define __SYS_H__
+
+#include "NUC100Series.h"
+
+#define TMR0_MODULE             0
+#define TMR1_MODULE             1
+#define TMR2_MODULE             2
+#define TMR3_MODULE             3
+#define CLK_CLKSEL1_TMR0_S_HXT  0
+#define CLK_CLKSEL1_TMR1_S_HXT  0
+#define CLK_CLKSEL1_TMR2_S_HXT  0
+#define CLK_CLKSEL1_TMR3_S_HXT  0
+#define TIMER_PERIODIC_MODE     1
+
+#define CLK_EnableModuleClock(module)               ((void)(module))
+#define CLK_SetModuleClock(module, src, div)        ((void)(module), (void)(src), (void)(div))
+#define CLK_SysTickDelay(us)                        emu_delay_us(us)
+
+#define TIMER_Open(timer, mode, hz)     emu_timer_open((int)((timer) - TIMER0), (hz))
+#define TIMER_EnableInt(timer)          ((void)(timer))
+#define TIMER_Start(timer)              emu_timer_start((int)((timer) - TIMER0))
+#define TIMER_Stop(timer)               emu_timer_stop((int)((timer) - TIMER0))
+#define TIMER_ClearIntFlag(timer)       ((void)(timer), emu_io())
+
+#endif
@@ -0,0 +1,14 @@
+/*
+ * Seven_Segment.h（SegEmu替代版）: 與BSP相同的七段顯示器函式宣告
+ */
+
+#ifndef __SEVEN_SEGMENT_H__
+#define __SEVEN_SEGMENT_H__
+
+#include <stdint.h>
+
+void OpenSevenSegment(void);
+void ShowSevenSegment(uint8_t no, uint8_t number);
+void CloseSevenSegment(void);
+
+#endif
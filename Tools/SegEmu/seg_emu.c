@@ -0,0 +1,354 @@
+/*
+ * ================================================================
+ * seg_emu.c: 七段顯示器時序模擬器（Linux主機端）
+ * 功能：虛擬腳位、虛擬時脈、計時器中斷與顯示分析
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include <string.h>
+#include "NUC100Series.h"
+#include "Segment_Glyph.h"
+#include "seg_emu.h"
+
+// ---------------- 虛擬腳位 ----------------
+static GPIO_T s_gpio[EMU_PORTS];                // 驅動看到的暫存器
+static uint32_t s_out[EMU_PORTS];               // 實際輸出（已套用DMASK）
+static volatile uint32_t s_pdio[EMU_PORTS][16]; // PDIO（PC4=1 等）
+static uint8_t s_pc = 0;                        // 目前PC4-7狀態
+static uint8_t s_pe = SEG_GLYPH_BLANK;          // 目前PE0-7狀態
+
+// ---------------- 虛擬時脈與計時器 ----------------
+static uint64_t s_now = 0;
+static uint8_t s_in_isr = 0;
+
+typedef struct {
+    uint64_t period;            // 週期（cycles）
+    uint64_t next;              // 下次觸發時間
+    uint8_t running;
+    EmuIrqHandler handler;
+} EmuTimer;
+
+static EmuTimer s_timer[EMU_TIMERS];
+TIMER_T emu_timer_regs[EMU_TIMERS];             // TIMER0->TISR 等直接存取的暫存器
+
+// ---------------- 分析狀態 ----------------
+typedef struct {
+    uint64_t on;                // 點亮總時間
+    uint64_t ghost;             // 殘影總時間
+    uint64_t ghost_run;         // 目前連續殘影長度
+    uint64_t max_ghost;
+    uint64_t dark_start;        // 最近一次熄滅時間
+    uint64_t max_dark;
+    uint32_t pulses;            // 點亮次數
+    uint8_t lit;
+} EmuDigitAcc;
+
+static uint8_t s_expect[EMU_DIGITS] = {
+    SEG_GLYPH_BLANK, SEG_GLYPH_BLANK, SEG_GLYPH_BLANK, SEG_GLYPH_BLANK
+};
+static EmuDigitAcc s_acc[EMU_DIGITS];
+static uint64_t s_mark = 0;                     // 上次狀態改變時間
+static uint64_t s_begin = 0;                    // 統計開始時間
+static uint8_t s_measuring = 0;
+static uint32_t s_isr_calls = 0;
+static uint64_t s_isr_io = 0;
+static uint64_t s_isr_cycles = 0;
+
+/*
+ * ================================================================
+ * 統計一段固定腳位狀態的時間
+ * ================================================================
+ */
+static void account(uint64_t until)
+{
+    uint64_t dt = until - s_mark;
+    uint8_t d, lit, ghost;
+
+    if (!s_measuring || dt == 0) {
+        s_mark = until;
+        return;
+    }
+
+    for (d = 0; d < EMU_DIGITS; d++) {
+        EmuDigitAcc *a = &s_acc[d];
+
+        lit = ((s_pc >> d) & 0x01) && (s_pe != SEG_GLYPH_BLANK);
+        ghost = lit && (s_pe != s_expect[d]);
+
+        if (lit) a->on += dt;
+        if (ghost) {
+            a->ghost += dt;
+            a->ghost_run += dt;
+            if (a->ghost_run > a->max_ghost) a->max_ghost = a->ghost_run;
+        } else {
+            a->ghost_run = 0;
+        }
+    }
+    s_mark = until;
+}
+
+/*
+ * ================================================================
+ * 腳位狀態改變：統計上一段時間並記錄點亮/熄滅邊緣
+ * ================================================================
+ */
+static void pins_changed(uint8_t pc, uint8_t pe)
+{
+    uint8_t d, lit;
+
+    account(s_now);
+    s_pc = pc;
+    s_pe = pe;
+
+    for (d = 0; d < EMU_DIGITS; d++) {
+        EmuDigitAcc *a = &s_acc[d];
+
+        lit = ((pc >> d) & 0x01) && (pe != SEG_GLYPH_BLANK);
+        if (lit && !a->lit) {
+            if (s_measuring) {
+                a->pulses++;
+                if (s_now - a->dark_start > a->max_dark) a->max_dark = s_now - a->dark_start;
+            }
+        } else if (!lit && a->lit) {
+            a->dark_start = s_now;
+        }
+        a->lit = lit;
+    }
+}
+
+/*
+ * ================================================================
+ * 結算上一次暫存器寫入
+ * 說明：emu_port()/emu_pdio() 回傳後驅動才寫入，因此在下一次存取
+ *       （或時間前進前）結算；兩次結算之間最多只有一次寫入
+ * ================================================================
+ */
+static void sync(void)
+{
+    int p, b;
+    uint32_t eff, bit;
+
+    for (p = 0; p < EMU_PORTS; p++) {
+        // DOUT：DMASK為1的位元保持原值
+        eff = (s_out[p] & s_gpio[p].DMASK) | (s_gpio[p].DOUT & ~s_gpio[p].DMASK);
+
+        // PDIO：不受DMASK影響
+        for (b = 0; b < 16; b++) {
+            bit = (s_out[p] >> b) & 0x01;
+            if ((s_pdio[p][b] & 0x01) != bit) {
+                eff = (eff & ~(1u << b)) | ((s_pdio[p][b] & 0x01) << b);
+            }
+        }
+
+        s_out[p] = eff;
+        s_gpio[p].DOUT = eff;
+        for (b = 0; b < 16; b++) s_pdio[p][b] = (eff >> b) & 0x01;
+    }
+
+    if ((uint8_t)((s_out[EMU_PORT_C] >> 4) & 0x0F) != s_pc ||
+        (uint8_t)(s_out[EMU_PORT_E] & 0xFF) != s_pe) {
+        pins_changed((uint8_t)((s_out[EMU_PORT_C] >> 4) & 0x0F),
+                     (uint8_t)(s_out[EMU_PORT_E] & 0xFF));
+    }
+}
+
+/*
+ * ================================================================
+ * 周邊存取
+ * ================================================================
+ */
+void emu_io(void)
+{
+    sync();
+    s_now += EMU_IO_CYCLES;
+    if (s_in_isr && s_measuring) s_isr_io++;
+}
+
+void *emu_port(int port)
+{
+    emu_io();
+    return &s_gpio[port];
+}
+
+volatile uint32_t *emu_pdio(int port, int bit)
+{
+    emu_io();
+    return &s_pdio[port][bit];
+}
+
+uint32_t emu_pins(int port)
+{
+    sync();
+    return s_out[port];
+}
+
+/*
+ * ================================================================
+ * 虛擬時脈
+ * ================================================================
+ */
+uint64_t emu_now(void)
+{
+    return s_now;
+}
+
+static void dispatch(EmuTimer *t)
+{
+    uint64_t start;
+
+    sync();
+    start = s_now;
+    s_in_isr = 1;
+    s_now += EMU_ISR_ENTRY_CYCLES;
+    t->handler();
+    sync();
+    s_now += EMU_ISR_EXIT_CYCLES;
+    s_in_isr = 0;
+
+    if (s_measuring) {
+        s_isr_calls++;
+        s_isr_cycles += s_now - start;
+    }
+}
+
+void emu_run(uint64_t cycles)
+{
+    uint64_t target = s_now + cycles;
+    int i, due;
+
+    sync();
+    for (;;) {
+        // 找出最早到期的計時器
+        due = -1;
+        for (i = 0; i < EMU_TIMERS; i++) {
+            if (!s_timer[i].running || !s_timer[i].handler) continue;
+            if (s_timer[i].next > target) continue;
+            if (due < 0 || s_timer[i].next < s_timer[due].next) due = i;
+        }
+        if (due < 0) break;
+
+        if (s_timer[due].next > s_now) s_now = s_timer[due].next;
+        s_timer[due].next += s_timer[due].period;
+        dispatch(&s_timer[due]);
+        // 中斷佔用的時間不歸還給主程式（與實際相同，延遲會被拉長）
+        if (s_now > target) target = s_now;
+    }
+    s_now = target;
+}
+
+void emu_delay_us(uint32_t us)
+{
+    emu_run((uint64_t)us * (EMU_HCLK / 1000000u));
+}
+
+/*
+ * ================================================================
+ * 計時器
+ * ================================================================
+ */
+void emu_timer_open(int timer, uint32_t hz)
+{
+    if (timer < 0 || timer >= EMU_TIMERS || hz == 0) return;
+    s_timer[timer].period = EMU_HCLK / hz;
+    s_timer[timer].running = 0;
+}
+
+void emu_timer_start(int timer)
+{
+    if (timer < 0 || timer >= EMU_TIMERS) return;
+    s_timer[timer].next = s_now + s_timer[timer].period;
+    s_timer[timer].running = 1;
+}
+
+void emu_timer_stop(int timer)
+{
+    if (timer < 0 || timer >= EMU_TIMERS) return;
+    s_timer[timer].running = 0;
+}
+
+void emu_set_vector(int timer, EmuIrqHandler handler)
+{
+    if (timer < 0 || timer >= EMU_TIMERS) return;
+    s_timer[timer].handler = handler;
+}
+
+/*
+ * ================================================================
+ * 重設與分析
+ * ================================================================
+ */
+void emu_reset(void)
+{
+    int b;
+
+    memset(s_gpio, 0, sizeof(s_gpio));
+    memset(s_out, 0, sizeof(s_out));
+    memset((void *)s_pdio, 0, sizeof(s_pdio));
+    memset(s_timer, 0, sizeof(s_timer));
+    memset(s_acc, 0, sizeof(s_acc));
+    s_out[EMU_PORT_E] = s_gpio[EMU_PORT_E].DOUT = SEG_GLYPH_BLANK;     // 段選上電為高電位（熄滅）
+    for (b = 0; b < 8; b++) s_pdio[EMU_PORT_E][b] = (SEG_GLYPH_BLANK >> b) & 0x01;
+    s_pc = 0;
+    s_pe = SEG_GLYPH_BLANK;
+    s_now = 0;
+    s_mark = 0;
+    s_in_isr = 0;
+    s_measuring = 0;
+}
+
+void emu_expect(const uint8_t pattern[EMU_DIGITS])
+{
+    memcpy(s_expect, pattern, EMU_DIGITS);
+}
+
+void emu_measure_begin(void)
+{
+    uint8_t d;
+
+    sync();
+    account(s_now);
+    for (d = 0; d < EMU_DIGITS; d++) {
+        uint8_t lit = s_acc[d].lit;
+        memset(&s_acc[d], 0, sizeof(s_acc[d]));
+        s_acc[d].lit = lit;
+        s_acc[d].dark_start = s_now;
+    }
+    s_begin = s_now;
+    s_mark = s_now;
+    s_isr_calls = 0;
+    s_isr_io = 0;
+    s_isr_cycles = 0;
+    s_measuring = 1;
+}
+
+void emu_measure_end(EmuReport *r)
+{
+    double seconds, us_per_cycle;
+    uint8_t d;
+
+    sync();
+    account(s_now);
+    s_measuring = 0;
+
+    seconds = (double)(s_now - s_begin) / EMU_HCLK;
+    us_per_cycle = 1e6 / EMU_HCLK;
+
+    for (d = 0; d < EMU_DIGITS; d++) {
+        EmuDigitAcc *a = &s_acc[d];
+        uint64_t dark = a->max_dark;
+
+        if (!a->lit && s_now - a->dark_start > dark) dark = s_now - a->dark_start;
+
+        r->digit[d].refresh_hz = a->pulses / seconds;
+        r->digit[d].duty = (double)a->on / (double)(s_now - s_begin);
+        r->digit[d].ghost_us = a->ghost * us_per_cycle / seconds;
+        r->digit[d].max_ghost_us = a->max_ghost * us_per_cycle;
+        r->digit[d].max_dark_ms = dark * us_per_cycle / 1000.0;
+    }
+
+    r->isr_per_sec = s_isr_calls / seconds;
+    r->isr_io = s_isr_calls ? (double)s_isr_io / s_isr_calls : 0;
+    r->isr_cycles = s_isr_calls ? (double)s_isr_cycles / s_isr_calls : 0;
+    r->isr_load = (double)s_isr_cycles / (double)(s_now - s_begin);
+}
@@ -0,0 +1,88 @@
+/*
+ * ================================================================
+ * seg_emu.h: 七段顯示器時序模擬器（Linux主機端）
+ * 功能：以虛擬時脈模擬PC4-7位選、PE0-7段選，執行實際的
+ *       Seven_Segment.c驅動與掃描中斷，統計每個位數的
+ *       更新率、工作週期、殘影時間與最長熄滅時間
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 模擬方式：
+ * - include/ 內的替代BSP標頭把 PC、PE、PC4... 等暫存器存取
+ *   轉成 emu_port()/emu_pdio() 呼叫；每次存取先結算上一次寫入，
+ *   再前進 EMU_IO_CYCLES 個週期，因此驅動中每個中間狀態都有時間長度
+ * - DOUT寫入依DMASK合併，PDIO（PC4=1 等）不受DMASK影響，與硬體相同
+ * - 中斷由 emu_timer_open() 設定的週期產生，進入/離開各計 EMU_ISR_*_CYCLES
+ * - CPU時間只計算周邊存取與中斷進出，不含一般運算指令（用於比較不同驅動）
+ */
+
+#ifndef __SEG_EMU_H__
+#define __SEG_EMU_H__
+
+#include <stdint.h>
+
+// ================================================================
+// 模擬參數
+// ================================================================
+#define EMU_HCLK                50000000u   // CPU時脈（Hz）
+#define EMU_IO_CYCLES           3           // 每次周邊暫存器存取
+#define EMU_ISR_ENTRY_CYCLES    16          // 中斷進入（Cortex-M0 堆疊）
+#define EMU_ISR_EXIT_CYCLES     16          // 中斷返回
+#define EMU_TIMERS              4           // TIMER0-3
+
+#define EMU_DIGITS              4
+#define EMU_PORT_C              2
+#define EMU_PORT_E              4
+#define EMU_PORTS               5           // PA-PE
+
+typedef void (*EmuIrqHandler)(void);
+
+// ================================================================
+// 暫存器存取（由 include/NUC100Series.h 的巨集呼叫）
+// ================================================================
+void *emu_port(int port);
+volatile uint32_t *emu_pdio(int port, int bit);
+void emu_io(void);                          // 其他周邊存取（如清除中斷旗標）
+uint32_t emu_pins(int port);                // 目前實際輸出（結算上一次寫入，不前進時脈）
+
+// ================================================================
+// 虛擬時脈與中斷
+// ================================================================
+uint64_t emu_now(void);                     // 目前週期數
+void emu_run(uint64_t cycles);              // 主程式執行/等待 cycles 週期（期間會發生中斷）
+void emu_delay_us(uint32_t us);             // CLK_SysTickDelay()
+void emu_timer_open(int timer, uint32_t hz);
+void emu_timer_start(int timer);
+void emu_timer_stop(int timer);
+void emu_set_vector(int timer, EmuIrqHandler handler);
+
+// ================================================================
+// 分析
+// ================================================================
+typedef struct {
+    double refresh_hz;          // 每秒點亮次數
+    double duty;                // 點亮時間比例
+    double ghost_us;            // 每秒顯示錯誤段碼的時間
+    double max_ghost_us;        // 最長一次殘影
+    double max_dark_ms;         // 最長熄滅時間
+} EmuDigitStats;
+
+typedef struct {
+    EmuDigitStats digit[EMU_DIGITS];
+    double isr_per_sec;         // 每秒中斷次數
+    double isr_io;              // 每次中斷的周邊存取次數
+    double isr_cycles;          // 每次中斷的估計週期數
+    double isr_load;            // 中斷佔用CPU比例
+} EmuReport;
+
+// 重設模擬器（時脈歸零、腳位全關、計時器停止）
+void emu_reset(void);
+
+// 設定每個位數應顯示的段碼（PE值），用於判斷殘影；SEG_GLYPH_BLANK 表示應熄滅
+void emu_expect(const uint8_t pattern[EMU_DIGITS]);
+
+// 從現在起開始統計 / 結束統計並產生報告
+void emu_measure_begin(void);
+void emu_measure_end(EmuReport *report);
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * ================================================================
+ * seg_legacy.c: 逐腳位寫入的七段顯示器驅動（比較用）
+ * 功能：重現改用DMASK單次寫入之前的 Seven_Segment.c 寫法
+ *       （PE0-7、PC4-7 以PDIO逐一寫入），作為模擬器的對照組
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#include "NUC100Series.h"
+
+// ================================================================
+// 原本的段模式（Lab-5/5.2/Seven_Segment.c，逐字保留）
+// ================================================================
+// 不使用 Segment_Glyph.c 的字形表：-c 比較時兩種驅動的字形來源各自獨立，
+// 改動 SEG_GLYPH_HEX 的任何一個值都會被比較出來
+#define SEG_N0 0x82             // 數字0的段模式
+#define SEG_N1 0xEE             // 數字1的段模式
+#define SEG_N2 0x07             // 數字2的段模式
+#define SEG_N3 0x46             // 數字3的段模式
+#define SEG_N4 0x6A             // 數字4的段模式
+#define SEG_N5 0x52             // 數字5的段模式
+#define SEG_N6 0x12             // 數字6的段模式
+#define SEG_N7 0xE6             // 數字7的段模式
+#define SEG_N8 0x02             // 數字8的段模式
+#define SEG_N9 0x62             // 數字9的段模式
+#define SEG_N10 0x22            // 數字A(10)的段模式
+#define SEG_N11 0x1A            // 數字B(11)的段模式
+#define SEG_N12 0x93            // 數字C(12)的段模式
+#define SEG_N13 0x0E            // 數字D(13)的段模式
+#define SEG_N14 0x13            // 數字E(14)的段模式
+#define SEG_N15 0x33            // 數字F(15)的段模式
+#define SEG_N16 0x7F            // 負號"-"的段模式
+
+static const uint8_t SEG_BUF[17]={SEG_N0, SEG_N1, SEG_N2, SEG_N3, SEG_N4, SEG_N5,
+                                  SEG_N6, SEG_N7, SEG_N8, SEG_N9, SEG_N10, SEG_N11,
+                                  SEG_N12, SEG_N13, SEG_N14, SEG_N15, SEG_N16};
+
+void Legacy_OpenSevenSegment(void)
+{
+    PC4 = 0; PC5 = 0; PC6 = 0; PC7 = 0;
+    PE0 = 0; PE1 = 0; PE2 = 0; PE3 = 0;
+    PE4 = 0; PE5 = 0; PE6 = 0; PE7 = 0;
+}
+
+void Legacy_ShowSevenSegment(uint8_t no, uint8_t number)
+{
+    uint8_t temp = SEG_BUF[number];
+    uint8_t i;
+
+    // 段碼逐位元寫入（每個位元一次PDIO存取）
+    for (i = 0; i < 8; i++) {
+        switch (i) {
+            case 0: PE0 = temp & 0x01; break;
+            case 1: PE1 = temp & 0x01; break;
+            case 2: PE2 = temp & 0x01; break;
+            case 3: PE3 = temp & 0x01; break;
+            case 4: PE4 = temp & 0x01; break;
+            case 5: PE5 = temp & 0x01; break;
+            case 6: PE6 = temp & 0x01; break;
+            case 7: PE7 = temp & 0x01; break;
+        }
+        temp = temp >> 1;
+    }
+
+    // 只開啟指定位選，其他位選不變（依賴呼叫前先CloseSevenSegment）
+    switch (no) {
+        case 0: PC4 = 1; break;
+        case 1: PC5 = 1; break;
+        case 2: PC6 = 1; break;
+        case 3: PC7 = 1; break;
+    }
+}
+
+void Legacy_CloseSevenSegment(void)
+{
+    PC4 = 0; PC5 = 0; PC6 = 0; PC7 = 0;
+}
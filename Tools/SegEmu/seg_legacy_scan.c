@@ -0,0 +1,16 @@
+/*
+ * ================================================================
+ * seg_legacy_scan.c: 以逐腳位驅動編譯的 Segment_FrameScan.c（比較用）
+ * 功能：Lab 9/10 的掃描情境以同一份 Library/Segment_FrameScan.c 分別
+ *       搭配兩種驅動執行；本檔把驅動函數改名為 seg_legacy.c 的版本後
+ *       直接引入原始檔，產生 Legacy_frameScan()
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ */
+
+#define CloseSevenSegment   Legacy_CloseSevenSegment
+#define ShowSevenSegment    Legacy_ShowSevenSegment
+#define OpenSevenSegment    Legacy_OpenSevenSegment
+#define Segment_frameScan   Legacy_frameScan
+
+#include "Segment_FrameScan.c"
@@ -0,0 +1,345 @@
+/*
+ * ================================================================
+ * seg_scenarios.c: 七段顯示器時序模擬器主程式
+ * 功能：以各實驗的多工掃描方式顯示"1234"，比較兩種驅動的
+ *       更新率、工作週期、殘影與最長熄滅時間
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 用法：segemu [-t 模擬毫秒數] [-s 情境名稱關鍵字]
+ *       segemu -c    比較逐腳位驅動與 Segment_Port.c 寫入後的腳位狀態
+ * 回傳值：DOUT驅動（Library/Segment_Port.c）出現殘影，或 -c 比較出現
+ *         預期以外的差異時為1，否則為0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "NUC100Series.h"
+#include "SYS.h"
+#include "Segment_Port.h"
+#include "Segment_Glyph.h"
+#include "Segment_Scan.h"
+#include "Segment_Frame.h"
+#include "Segment_FrameScan.h"
+#include "seg_emu.h"
+
+// ================================================================
+// 參數設定
+// ================================================================
+#define WARMUP_MS       50              // 開始統計前先執行的時間
+#define FLICKER_HZ      60              // 低於此更新率視為可能閃爍
+#define FLICKER_DARK_MS 16              // 熄滅超過此時間視為可能閃爍
+
+// ---------------- 驅動 ----------------
+extern void Legacy_OpenSevenSegment(void);
+extern void Legacy_ShowSevenSegment(uint8_t no, uint8_t number);
+extern void Legacy_CloseSevenSegment(void);
+extern void Legacy_frameScan(SegmentFrameScan *s);  // seg_legacy_scan.c
+extern void TMR2_IRQHandler(void);          // Segment_Scan.c
+
+typedef struct {
+    const char *name;
+    void (*open)(void);
+    void (*show)(uint8_t no, uint8_t number);
+    void (*close)(void);
+    void (*frame_scan)(SegmentFrameScan *s);    // Segment_FrameScan.c 以此驅動編譯的版本
+} Driver;
+
+static const Driver s_drivers[] = {
+    { "per-pin", Legacy_OpenSevenSegment, Legacy_ShowSevenSegment, Legacy_CloseSevenSegment, Legacy_frameScan  },
+    { "DOUT",    OpenSevenSegment,        ShowSevenSegment,        CloseSevenSegment,        Segment_frameScan },
+};
+#define DRIVER_COUNT    (sizeof(s_drivers) / sizeof(s_drivers[0]))
+#define DRIVER_DOUT     1
+
+static const Driver *s_drv;
+
+// 顯示內容："1234"（位數0=最右邊）
+static const uint8_t s_digits[EMU_DIGITS] = { 4, 3, 2, 1 };
+static uint32_t s_run_ms = 1000;
+
+/*
+ * ================================================================
+ * 忙碌等待掃描（Lab 3/4/5）
+ * ================================================================
+ */
+typedef struct {
+    uint32_t dwell_us;          // 每位數延遲
+    uint32_t tail_us;           // 每圈結尾延遲（主迴圈其他延遲）
+    uint8_t close_after;        // 1=顯示→延遲→關閉（Lab 5.1），0=關閉→顯示→延遲
+} BusyWait;
+
+static void run_busy_wait(const BusyWait *bw, uint64_t until)
+{
+    int8_t no;
+
+    while (emu_now() < until) {
+        for (no = EMU_DIGITS - 1; no >= 0; no--) {
+            if (!bw->close_after) s_drv->close();
+            s_drv->show((uint8_t)no, s_digits[no]);
+            emu_delay_us(bw->dwell_us);
+            if (bw->close_after) s_drv->close();
+        }
+        if (bw->tail_us) emu_delay_us(bw->tail_us);
+    }
+}
+
+/*
+ * ================================================================
+ * Lab 9：TIMER0 400Hz（TCMPR=2500），雙緩衝畫面
+ * 掃描與 Lab-9/Q2-final.c TMR0_IRQHandler 相同，呼叫 Library/Segment_FrameScan.c
+ * ================================================================
+ */
+static SegmentFrame s_lab9_frame = SEG_FRAME_INIT(SEG_FRAME_BLANK);
+static SegmentFrameScan s_lab9_scan = SEG_FRAME_SCAN_INIT(s_lab9_frame);
+
+static void lab9_tmr0_isr(void)
+{
+    TIMER0->TISR = 1;
+    emu_io();
+    s_drv->frame_scan(&s_lab9_scan);
+}
+
+/*
+ * ================================================================
+ * Lab 10：TIMER1 1kHz 掃描（按鍵掃描部分不列入）
+ * 掃描與 Lab-10/Q1.c、Q2.c TMR1_IRQHandler 相同，呼叫 Library/Segment_FrameScan.c
+ * ================================================================
+ */
+static SegmentFrame s_lab10_frame = SEG_FRAME_INIT(0);
+static SegmentFrameScan s_lab10_scan = SEG_FRAME_SCAN_INIT(s_lab10_frame);
+
+static void lab10_tmr1_isr(void)
+{
+    s_drv->frame_scan(&s_lab10_scan);
+    TIMER_ClearIntFlag(TIMER1);
+}
+
+/*
+ * ================================================================
+ * 情境表
+ * ================================================================
+ */
+typedef enum { SCHEME_BUSY, SCHEME_LAB9, SCHEME_LAB10, SCHEME_SCAN } Scheme;
+
+typedef struct {
+    const char *name;
+    Scheme scheme;
+    BusyWait busy;
+    uint8_t level[EMU_DIGITS];  // Segment_Scan 亮度
+    uint8_t dout_only;          // 1=只能使用DOUT驅動
+} Scenario;
+
+static const Scenario s_scenarios[] = {
+    { "lab3-busy-5ms",   SCHEME_BUSY,  { 5000, 1000, 0 }, {0}, 0 },
+    { "lab4-busy-200us", SCHEME_BUSY,  { 200,  0,    0 }, {0}, 0 },
+    { "lab5.1-busy-5ms", SCHEME_BUSY,  { 5000, 0,    1 }, {0}, 0 },
+    { "lab5.2-busy-1ms", SCHEME_BUSY,  { 1000, 0,    0 }, {0}, 0 },
+    { "lab9-tmr0-400hz", SCHEME_LAB9,  { 0 },             {0}, 0 },
+    { "lab10-tmr1-1khz", SCHEME_LAB10, { 0 },             {0}, 0 },
+    { "scan-tmr2-4khz",  SCHEME_SCAN,  { 0 }, { 8, 8, 8, 8 }, 1 },
+    { "scan-tmr2-dim",   SCHEME_SCAN,  { 0 }, { 8, 4, 2, 1 }, 1 },
+};
+#define SCENARIO_COUNT  (sizeof(s_scenarios) / sizeof(s_scenarios[0]))
+
+/*
+ * ================================================================
+ * 執行一個情境
+ * ================================================================
+ */
+static void run_for(const Scenario *sc, uint64_t cycles)
+{
+    if (sc->scheme == SCHEME_BUSY) run_busy_wait(&sc->busy, emu_now() + cycles);
+    else emu_run(cycles);
+}
+
+static int run_scenario(const Scenario *sc, const Driver *drv)
+{
+    const int8_t digits[EMU_DIGITS] = { 4, 3, 2, 1 };
+    uint8_t expect[EMU_DIGITS];
+    EmuReport r;
+    uint8_t d;
+    int ghost = 0;
+
+    for (d = 0; d < EMU_DIGITS; d++) expect[d] = SEG_GLYPH_HEX[s_digits[d]];
+
+    emu_reset();
+    emu_expect(expect);
+    s_drv = drv;
+
+    switch (sc->scheme) {
+    case SCHEME_BUSY:
+        drv->open();
+        break;
+    case SCHEME_LAB9:
+        drv->open();
+        Segment_framePublish(&s_lab9_frame, digits);
+        s_lab9_scan.index = 0;
+        emu_set_vector(0, lab9_tmr0_isr);
+        emu_timer_open(0, 12000000u / 12 / 2500);   // HXT 12MHz, Prescaler=11, CMP=2500
+        emu_timer_start(0);
+        break;
+    case SCHEME_LAB10:
+        drv->open();
+        Segment_framePublish(&s_lab10_frame, digits);
+        s_lab10_scan.index = 0;
+        emu_set_vector(1, lab10_tmr1_isr);
+        emu_timer_open(1, 1000);
+        emu_timer_start(1);
+        break;
+    case SCHEME_SCAN:
+        emu_set_vector(2, TMR2_IRQHandler);
+        Segment_scanInit();
+        for (d = 0; d < EMU_DIGITS; d++) {
+            Segment_setDigit(d, s_digits[d]);
+            Segment_setBrightness(d, sc->level[d]);
+        }
+        break;
+    }
+
+    run_for(sc, (uint64_t)WARMUP_MS * (EMU_HCLK / 1000));
+    emu_measure_begin();
+    run_for(sc, (uint64_t)s_run_ms * (EMU_HCLK / 1000));
+    emu_measure_end(&r);
+
+    printf("%-16s %-8s", sc->name, drv->name);
+    if (r.isr_per_sec > 0) {
+        printf("  ISR %.0f/s, %.1f io, ~%.0f cycles, load %.3f%%\n",
+               r.isr_per_sec, r.isr_io, r.isr_cycles, r.isr_load * 100);
+    } else {
+        printf("  (busy-wait, no ISR)\n");
+    }
+    for (d = EMU_DIGITS; d-- > 0; ) {
+        EmuDigitStats *s = &r.digit[d];
+        int flicker = (s->refresh_hz < FLICKER_HZ) || (s->max_dark_ms > FLICKER_DARK_MS);
+
+        printf("    digit %u  refresh %7.1f Hz  duty %5.1f%%  ghost %8.2f us/s (max %6.2f us)  dark max %6.2f ms%s%s\n",
+               d, s->refresh_hz, s->duty * 100, s->ghost_us, s->max_ghost_us, s->max_dark_ms,
+               flicker ? "  FLICKER" : "", s->ghost_us > 0 ? "  GHOST" : "");
+        if (s->ghost_us > 0) ghost = 1;
+    }
+    return ghost;
+}
+
+/*
+ * ================================================================
+ * 腳位狀態比較（-c）
+ * 說明：對每個 (字形0-16, 位置0-3)，從相同的腳位狀態開始，分別執行
+ *       Legacy_ShowSevenSegment()、ShowSevenSegment()、
+ *       ShowSevenSegmentPattern(no, SEG_GLYPH_HEX[n])，比較結束後的
+ *       PE、PC輸出。起始狀態有兩種：
+ *       - 位選全關（CloseSevenSegment()之後，所有掃描程式的用法）：應完全相同
+ *       - 位選全開：逐腳位驅動只設定指定位選，其他三個維持1；DOUT驅動
+ *         一次寫入PC4-7，其他三個被清為0，這是唯一允許的差異
+ *       段選起始值為新字形的反相，每個段都必須被寫入才會相同；
+ *       PE8-15、PC0-3、PC8-15 起始為1，檢查驅動沒有動到其他腳位
+ * ================================================================
+ */
+#define CMP_PE_OTHER    0x0000FF00u
+#define CMP_PC_OTHER    0x0000FF0Fu
+
+typedef struct {
+    uint32_t pe;
+    uint32_t pc;
+} PinState;
+
+// 從指定的起始位選與段選開始執行一次顯示，回傳結束後的輸出
+static PinState run_show(int which, uint8_t no, uint8_t number, uint8_t selects)
+{
+    PinState st;
+
+    emu_reset();
+    PE->DOUT = CMP_PE_OTHER;                    // DMASK尚未設定：其他腳位設為1
+    PC->DOUT = CMP_PC_OTHER;
+    OpenSevenSegment();                         // 設定DMASK，兩種驅動起始相同
+    PE->DOUT = (uint8_t)~SEG_GLYPH_HEX[number];
+    PC->DOUT = (uint32_t)selects << SEG_PC_SHIFT;
+
+    switch (which) {
+    case 0:  Legacy_ShowSevenSegment(no, number); break;
+    case 1:  ShowSevenSegment(no, number); break;
+    default: ShowSevenSegmentPattern(no, SEG_GLYPH_HEX[number]); break;
+    }
+    st.pe = emu_pins(EMU_PORT_E);
+    st.pc = emu_pins(EMU_PORT_C);
+    return st;
+}
+
+static int compare_drivers(void)
+{
+    static const char *const names[] = { "ShowSevenSegment", "ShowSevenSegmentPattern" };
+    static const uint8_t starts[] = { 0x0, 0xF };
+    unsigned int s, k, same, cleared, other;
+    uint8_t n, no;
+    int fail = 0;
+
+    printf("SegEmu: per-pin vs Segment_Port.c, %u glyphs x %u positions\n\n",
+           SEG_GLYPH_HEX_COUNT, EMU_DIGITS);
+
+    for (s = 0; s < sizeof(starts); s++) {
+        for (k = 0; k < 2; k++) {
+            same = cleared = other = 0;
+            for (n = 0; n < SEG_GLYPH_HEX_COUNT; n++) {
+                for (no = 0; no < EMU_DIGITS; no++) {
+                    PinState a = run_show(0, no, n, starts[s]);
+                    PinState b = run_show((int)k + 1, no, n, starts[s]);
+
+                    if (a.pe == b.pe && a.pc == b.pc) {
+                        same++;
+                    } else if (a.pe == b.pe &&
+                               b.pc == ((a.pc & ~(uint32_t)SEG_PC_MASK) | ((uint32_t)0x01 << (SEG_PC_SHIFT + no)))) {
+                        cleared++;          // 只差在其他三個位選被關閉
+                    } else {
+                        if (other++ == 0)
+                            printf("  first mismatch: glyph %u pos %u  per-pin PE=%04X PC=%04X  new PE=%04X PC=%04X\n",
+                                   n, no, (unsigned)a.pe, (unsigned)a.pc, (unsigned)b.pe, (unsigned)b.pc);
+                    }
+                }
+            }
+            printf("selects %s  %-24s same %2u  other-selects-cleared %2u  other %2u\n",
+                   starts[s] ? "all on " : "all off", names[k], same, cleared, other);
+            if (other || (starts[s] == 0 && cleared)) fail = 1;
+        }
+    }
+    return fail;
+}
+
+/*
+ * ================================================================
+ * 主程式
+ * ================================================================
+ */
+int main(int argc, char **argv)
+{
+    const char *filter = NULL;
+    unsigned int i, k;
+    int i_arg, fail = 0;
+
+    for (i_arg = 1; i_arg < argc; i_arg++) {
+        if (!strcmp(argv[i_arg], "-t") && i_arg + 1 < argc) {
+            s_run_ms = (uint32_t)atoi(argv[++i_arg]);
+            if (s_run_ms == 0) s_run_ms = 1;
+        } else if (!strcmp(argv[i_arg], "-s") && i_arg + 1 < argc) {
+            filter = argv[++i_arg];
+        } else if (!strcmp(argv[i_arg], "-c")) {
+            return compare_drivers();
+        } else {
+            fprintf(stderr, "usage: %s [-t ms] [-s scenario] | -c\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("SegEmu: HCLK %u Hz, %u cycles/IO, showing \"1234\" for %u ms\n\n",
+           EMU_HCLK, EMU_IO_CYCLES, s_run_ms);
+
+    for (i = 0; i < SCENARIO_COUNT; i++) {
+        if (filter && !strstr(s_scenarios[i].name, filter)) continue;
+        for (k = 0; k < DRIVER_COUNT; k++) {
+            if (s_scenarios[i].dout_only && k != DRIVER_DOUT) continue;
+            if (run_scenario(&s_scenarios[i], &s_drivers[k]) && k == DRIVER_DOUT) fail = 1;
+        }
+        printf("\n");
+    }
+    return fail;
+}
@@ -0,0 +1,205 @@
+/*
+ * ================================================================
+ * seg_frame_check.c: 七段顯示器雙緩衝畫面的中斷插入檢查（Linux x86-64主機端）
+ * 功能：以單步執行（EFLAGS.TF）在寫入端每一個指令之後插入掃描中斷，
+ *       執行實際的 Library/Segment_Frame.c，確認每一輪掃描顯示的
+ *       4個位數都來自同一個畫面，且最後一定顯示最新的畫面
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 寫入端（與Lab 9/10相同的用法）：
+ *   Segment_framePublish(&f, B);
+ *   d = Segment_frameBegin(&f); d[0..3] = C; Segment_frameCommit(&f);
+ * 寫入端開始前畫面為A，掃描端已走到位數0-3中的任一個。
+ *
+ * 寫入端執行時開啟單步旗標，每個指令之後產生SIGTRAP；第k1、k2個指令
+ * 之後在訊號處理函數中執行一次掃描中斷（與 Lab-10/Q2.c TMR1_IRQHandler
+ * 相同：位數0時 Segment_frameLatch()，再讀出該位數）。走過所有
+ * k1（單一中斷）與 k1 < k2（兩次中斷）的組合，每個組合再搭配4種
+ * 掃描起始位數；寫入端的每一次記憶體存取之間都至少被插入一次。
+ *
+ * 指令邊界比Cortex-M0的記憶體存取邊界更細（主機一個指令最多一次儲存），
+ * 因此涵蓋了開發板上中斷可能發生的每個位置。
+ *
+ * 用法：segframecheck
+ * 回傳值：出現混合兩個畫面的一輪、畫面倒退或最後沒有顯示最新畫面時為1
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <ucontext.h>
+#include "Segment_Frame.h"
+
+#if !defined(__x86_64__)
+#error "seg_frame_check.c uses the x86-64 trap flag"
+#endif
+
+#define TF_BIT          0x100
+#define MAX_STEPS       4096
+#define FRAME_COUNT     3
+
+static const int8_t s_frames[FRAME_COUNT][SEG_FRAME_DIGITS] = {
+    { 1, 2, 3, 4 },             // A：寫入端開始前
+    { 5, 6, 7, 8 },             // B：Segment_framePublish()
+    { 9, 10, 11, 12 },          // C：Begin / 逐位數寫入 / Commit
+};
+
+// ---------------- 掃描端（中斷） ----------------
+static SegmentFrame s_frame;
+static const volatile int8_t *s_scan;
+static uint8_t s_index;
+static int8_t s_shown[SEG_FRAME_DIGITS];
+static int s_last;              // 上一輪顯示的畫面（-1=尚未完成一輪）
+static unsigned long s_errors;
+static unsigned long s_rounds;
+static unsigned int s_k1, s_k2, s_start;
+
+static int frame_of(const int8_t d[SEG_FRAME_DIGITS])
+{
+    int i;
+
+    for (i = 0; i < FRAME_COUNT; i++)
+        if (!memcmp(d, s_frames[i], SEG_FRAME_DIGITS)) return i;
+    return -1;
+}
+
+static void scan_tick(void)
+{
+    int n;
+
+    if (s_index == 0) s_scan = Segment_frameLatch(&s_frame);
+    s_shown[s_index] = s_scan[s_index];
+    if (++s_index < SEG_FRAME_DIGITS) return;
+
+    // 一輪結束：4個位數必須來自同一個畫面，且不可倒退
+    s_index = 0;
+    s_rounds++;
+    n = frame_of(s_shown);
+    if (n < 0 || n < s_last) {
+        if (s_errors++ < 10)
+            printf("  start %u, ticks after %u/%u: shown %d %d %d %d (%s)\n",
+                   s_start, s_k1, s_k2, s_shown[0], s_shown[1], s_shown[2], s_shown[3],
+                   n < 0 ? "torn" : "went back");
+    }
+    if (n >= 0) s_last = n;
+}
+
+// ---------------- 單步執行 ----------------
+static volatile unsigned int s_step;
+static volatile int s_tracing;
+
+static void on_trap(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = (ucontext_t *)ctx;
+    unsigned int k;
+
+    (void)sig;
+    (void)si;
+    if (!s_tracing) {
+        uc->uc_mcontext.gregs[REG_EFL] &= ~TF_BIT;
+        return;
+    }
+    k = ++s_step;
+    if (k == s_k1 || k == s_k2) scan_tick();
+    if (k >= MAX_STEPS) uc->uc_mcontext.gregs[REG_EFL] &= ~TF_BIT;
+}
+
+static inline void trace_on(void)
+{
+    s_tracing = 1;
+    __asm__ volatile("pushfq; orq %0, (%%rsp); popfq" : : "i"(TF_BIT) : "memory", "cc");
+}
+
+static inline void trace_off(void)
+{
+    __asm__ volatile("pushfq; andq %0, (%%rsp); popfq" : : "i"(~TF_BIT) : "memory", "cc");
+    s_tracing = 0;
+}
+
+// 寫入端：在單步執行下發佈B與C
+static void __attribute__((noinline)) writer(void)
+{
+    volatile int8_t *d;
+    uint8_t i;
+
+    Segment_framePublish(&s_frame, s_frames[1]);
+    d = Segment_frameBegin(&s_frame);
+    for (i = 0; i < SEG_FRAME_DIGITS; i++) d[i] = s_frames[2][i];
+    Segment_frameCommit(&s_frame);
+}
+
+// 執行一個組合，回傳寫入端的指令數
+static unsigned int run(unsigned int start, unsigned int k1, unsigned int k2)
+{
+    static const SegmentFrame blank = SEG_FRAME_INIT(SEG_FRAME_BLANK);
+    unsigned int i, steps;
+
+    s_frame = blank;
+    s_index = 0;
+    s_last = -1;
+    s_start = start;
+    s_k1 = k1;
+    s_k2 = k2;
+
+    // 畫面A已顯示一整輪，掃描端再走到位數start
+    Segment_framePublish(&s_frame, s_frames[0]);
+    for (i = 0; i < SEG_FRAME_DIGITS + start; i++) scan_tick();
+
+    s_step = 0;
+    trace_on();
+    writer();
+    trace_off();
+    steps = s_step;
+
+    // 寫入端結束：完成目前這一輪，再掃描兩輪，最後一輪必須是C
+    for (i = 0; i < 3 * SEG_FRAME_DIGITS; i++) {
+        scan_tick();
+        if (s_index == 0 && i >= 2 * SEG_FRAME_DIGITS) break;
+    }
+    if (s_last != FRAME_COUNT - 1) {
+        if (s_errors++ < 10)
+            printf("  start %u, ticks after %u/%u: latest frame not shown (last %d)\n",
+                   start, k1, k2, s_last);
+    }
+    return steps;
+}
+
+int main(void)
+{
+    struct sigaction sa;
+    unsigned int n, start, k1, k2;
+    unsigned long runs = 0;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = on_trap;
+    sa.sa_flags = SA_SIGINFO;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGTRAP, &sa, NULL);
+
+    // 沒有插入中斷時的指令數
+    n = run(0, 0, 0);
+    if (n == 0 || n >= MAX_STEPS) {
+        printf("single-step failed (%u steps)\n", n);
+        return 1;
+    }
+
+    for (start = 0; start < SEG_FRAME_DIGITS; start++) {
+        for (k1 = 1; k1 <= n; k1++) {
+            run(start, k1, 0);
+            runs++;
+            for (k2 = k1 + 1; k2 <= n; k2++) {
+                run(start, k1, k2);
+                runs++;
+            }
+        }
+    }
+
+    printf("writer: %u instructions (Publish B, Begin/write/Commit C)\n", n);
+    printf("runs: %lu (4 scan start digits x one tick after each instruction, and every pair)\n", runs);
+    printf("rounds checked: %lu\n", s_rounds);
+    printf("check: %s\n", s_errors ? "FAIL" : "ok");
+    return s_errors ? 1 : 0;
+}
@@ -0,0 +1,339 @@
+/*
+ * ================================================================
+ * snake_bench.c: 貪食蛇蛇身資料結構效能測試（Linux主機端）
+ * 功能：蛇沿著走遍64x32盤面的封閉路徑前進（永遠不會撞到自己），
+ *       比較原本搬移整個陣列的寫法與 Snake_Body.c 方向格子
+ *       每一步的時間，以及加上自身碰撞檢查（逐節比較 / 佔用表）
+ *       後整個遊戲步的時間，長度從16到整個盤面；
+ *       以及盤面佔用10%、50%、95%時放水果的重選次數與時間
+ * 作者：damnm3@googlegroups.com 共同作者
+ * ================================================================
+ *
+ * 時間是主機的CPU時間，只用來比較隨長度增加的趨勢；另外列出每一步
+ * 寫入的座標位元組數（Cortex-M0 上每個位元組都是一次載入加一次儲存）。
+ *
+ * 用法：snakebench [-t 每項測試毫秒數]
+ * 回傳值：兩種寫法的蛇身內容或碰撞查詢結果不同，或 Snake_bodyRandomFree()
+ *         沒有一對一對應到所有空格時為1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Snake_Body.h"
+
+#define GRID_W          64
+#define GRID_H          32
+#define GRID_CELLS      (GRID_W * GRID_H)
+#define CHECK_TICKS     5000
+#define BATCH           1024
+#define SPAWNS          20000           // 每種佔用比例放水果的次數
+
+// ================================================================
+// 盤面路徑：x=0 一行由下往上，其餘各列蛇行走過 x=1..63，首尾相接
+// ================================================================
+static int8_t s_path_x[GRID_CELLS], s_path_y[GRID_CELLS];
+
+static void build_path(void)
+{
+    int n = 0, x, y;
+
+    for (y = 0; y < GRID_H; y++) {
+        if (y % 2 == 0) for (x = 1; x < GRID_W; x++) { s_path_x[n] = x; s_path_y[n++] = y; }
+        else for (x = GRID_W - 1; x >= 1; x--) { s_path_x[n] = x; s_path_y[n++] = y; }
+    }
+    for (y = GRID_H - 1; y >= 0; y--) { s_path_x[n] = 0; s_path_y[n++] = y; }
+}
+
+// ================================================================
+// 原本的寫法（Lab-9/Q2-final.c）：index 0 = 尾，len-1 = 頭
+// ================================================================
+static int8_t s_shift_x[GRID_CELLS], s_shift_y[GRID_CELLS];
+static uint16_t s_shift_len;
+
+static void __attribute__((noinline)) shift_move(int8_t new_x, int8_t new_y)
+{
+    int i;
+
+    for (i = 0; i < s_shift_len - 1; i++) {
+        s_shift_x[i] = s_shift_x[i + 1];
+        s_shift_y[i] = s_shift_y[i + 1];
+    }
+    s_shift_x[s_shift_len - 1] = new_x;
+    s_shift_y[s_shift_len - 1] = new_y;
+}
+
+// 原本的自身碰撞檢查：逐節比較（新的頭不在蛇身上時比較全部 len 節，是最壞情況）
+static int __attribute__((noinline)) shift_contains(int8_t x, int8_t y)
+{
+    int i;
+
+    for (i = 0; i < s_shift_len; i++)
+        if (s_shift_x[i] == x && s_shift_y[i] == y) return 1;
+    return 0;
+}
+
+static SnakeBody s_body;
+
+static void __attribute__((noinline)) body_move(int8_t new_x, int8_t new_y)
+{
+    Snake_bodyPop(&s_body, NULL, NULL);
+    Snake_bodyPush(&s_body, new_x, new_y);
+}
+
+// 整個遊戲步（Lab-9/Q2-final.c 的順序）：先檢查自身碰撞，再移動
+static volatile int s_hit;
+
+static void __attribute__((noinline)) shift_tick(int8_t new_x, int8_t new_y)
+{
+    s_hit = shift_contains(new_x, new_y);
+    shift_move(new_x, new_y);
+}
+
+static void __attribute__((noinline)) body_tick(int8_t new_x, int8_t new_y)
+{
+    s_hit = Snake_bodyContains(&s_body, new_x, new_y);
+    body_move(new_x, new_y);
+}
+
+// 兩種寫法都放入路徑上的前 len 格（尾在第0格），回傳下一個頭的路徑位置
+static int start_snake(uint16_t len)
+{
+    uint16_t i;
+
+    s_shift_len = len;
+    Snake_bodyInit(&s_body);
+    for (i = 0; i < len; i++) {
+        s_shift_x[i] = s_path_x[i];
+        s_shift_y[i] = s_path_y[i];
+        Snake_bodyPush(&s_body, s_path_x[i], s_path_y[i]);
+    }
+    return len % GRID_CELLS;
+}
+
+/*
+ * ================================================================
+ * 正確性檢查：兩種寫法同步前進，每一步比較頭尾與8個隨機格子（含盤面外）
+ * 的碰撞查詢，每97步比較每一節與整個盤面的查詢結果
+ * ================================================================
+ */
+static unsigned long check(uint16_t len)
+{
+    unsigned long errors = 0;
+    int pos = start_snake(len), t, k;
+    uint16_t i;
+    int8_t x, y;
+
+    for (t = 0; t < CHECK_TICKS; t++) {
+        for (k = 0; k < 8; k++) {
+            x = (int8_t)(rand() % (GRID_W + 4) - 2);
+            y = (int8_t)(rand() % (GRID_H + 4) - 2);
+            if (Snake_bodyContains(&s_body, x, y) != shift_contains(x, y)) errors++;
+        }
+        if (Snake_bodyContains(&s_body, s_path_x[pos], s_path_y[pos]) !=
+            shift_contains(s_path_x[pos], s_path_y[pos])) errors++;
+
+        shift_move(s_path_x[pos], s_path_y[pos]);
+        body_move(s_path_x[pos], s_path_y[pos]);
+        pos = (pos + 1) % GRID_CELLS;
+
+        if (s_body.len != len || SNAKE_BODY_HEAD_X(&s_body) != s_shift_x[len - 1] ||
+            SNAKE_BODY_HEAD_Y(&s_body) != s_shift_y[len - 1]) errors++;
+        if (t % 97 == 0) {
+            // 由尾巴沿方向碼走到頭，剛好 len 節
+            x = SNAKE_BODY_TAIL_X(&s_body);
+            y = SNAKE_BODY_TAIL_Y(&s_body);
+            for (i = 0; i < len; i++) {
+                if (x != s_shift_x[i] || y != s_shift_y[i]) errors++;
+                if (Snake_bodyNext(&s_body, &x, &y) != (i + 1 < len)) errors++;
+            }
+            Snake_bodyAt(&s_body, (uint16_t)(len / 2), &x, &y);
+            if (x != s_shift_x[len / 2] || y != s_shift_y[len / 2]) errors++;
+            for (y = 0; y < GRID_H; y++)
+                for (x = 0; x < GRID_W; x++)
+                    if (Snake_bodyContains(&s_body, x, y) != shift_contains(x, y)) errors++;
+        }
+    }
+    return errors;
+}
+
+// ================================================================
+// 效能測試
+// ================================================================
+static double now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// 平均每一步的奈秒數
+static double bench(uint16_t len, void (*move)(int8_t, int8_t), double run_us)
+{
+    unsigned long ticks = 0;
+    double start = now_us(), elapsed;
+    int pos = start_snake(len), k;
+
+    do {
+        for (k = 0; k < BATCH; k++) {
+            move(s_path_x[pos], s_path_y[pos]);
+            if (++pos == GRID_CELLS) pos = 0;
+        }
+        ticks += BATCH;
+        elapsed = now_us() - start;
+    } while (elapsed < run_us);
+    return elapsed * 1e3 / ticks;
+}
+
+/*
+ * ================================================================
+ * 放水果：原本隨機選格子、是蛇身就重選（逐節比較 / 佔用表），
+ * 與 Snake_bodyRandomFree() 直接選出空格
+ * ================================================================
+ */
+typedef struct {
+    double avg_tries, avg_ns, max_ns;
+    unsigned long max_tries;
+} SpawnStats;
+
+static volatile int8_t s_fruit_x, s_fruit_y;
+
+// 回傳重選次數（含最後一次）
+static unsigned long __attribute__((noinline)) spawn_retry(int bitmap)
+{
+    unsigned long tries = 0;
+    int8_t rx, ry;
+    int busy;
+
+    do {
+        tries++;
+        rx = (int8_t)(rand() % GRID_W);
+        ry = (int8_t)(rand() % GRID_H);
+        busy = bitmap ? Snake_bodyContains(&s_body, rx, ry) : shift_contains(rx, ry);
+    } while (busy);
+    s_fruit_x = rx;
+    s_fruit_y = ry;
+    return tries;
+}
+
+static unsigned long __attribute__((noinline)) spawn_free(void)
+{
+    int8_t fx, fy;
+
+    Snake_bodyRandomFree(&s_body, (uint32_t)rand(), &fx, &fy);
+    s_fruit_x = fx;
+    s_fruit_y = fy;
+    return 1;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// mode 0=重選+逐節比較、1=重選+佔用表、2=直接選出空格；每次分別計時（扣除計時本身）
+static SpawnStats bench_spawn(uint16_t len, int mode)
+{
+    SpawnStats st = { 0, 0, 0, 0 };
+    double t0, t1, overhead = 1e9, total_ns = 0, ns;
+    unsigned long tries, total_tries = 0;
+    int k;
+
+    for (k = 0; k < 1000; k++) {
+        t0 = now_ns();
+        t1 = now_ns();
+        if (t1 - t0 < overhead) overhead = t1 - t0;
+    }
+
+    start_snake(len);
+    srand(1);
+    for (k = 0; k < SPAWNS; k++) {
+        t0 = now_ns();
+        tries = mode == 2 ? spawn_free() : spawn_retry(mode);
+        ns = now_ns() - t0 - overhead;
+        total_tries += tries;
+        total_ns += ns;
+        if (tries > st.max_tries) st.max_tries = tries;
+        if (ns > st.max_ns) st.max_ns = ns;
+    }
+    st.avg_tries = (double)total_tries / SPAWNS;
+    st.avg_ns = total_ns / SPAWNS;
+    return st;
+}
+
+// r = 0..空格數-1 必須依序（由上而下、由左而右）對應到每一個空格，r 超過時回繞
+static unsigned long check_spawn(uint16_t len)
+{
+    unsigned long errors = 0;
+    int x, y, free_cells = GRID_CELLS - len;
+    uint32_t r = 0;
+    int8_t fx, fy;
+
+    start_snake(len);
+    for (y = 0; y < GRID_H; y++)
+        for (x = 0; x < GRID_W; x++) {
+            if (shift_contains(x, y)) continue;
+            if (!Snake_bodyRandomFree(&s_body, r, &fx, &fy) || fx != x || fy != y) errors++;
+            if (!Snake_bodyRandomFree(&s_body, r + (uint32_t)free_cells * 7, &fx, &fy) ||
+                fx != x || fy != y) errors++;
+            r++;
+        }
+    if (r != (uint32_t)free_cells) errors++;
+    return errors;
+}
+
+int main(int argc, char **argv)
+{
+    static const uint16_t lengths[] = { 16, 100, 256, 1024, GRID_CELLS - 1 };   // 盤面剩一格：新的頭不在蛇身上
+    static const int occupancy[] = { 10, 50, 95 };
+    static const char * const spawn_names[] = { "retry+scan", "retry+bitmap", "free index" };
+    double run_us = 200e3, shift_ns, body_ns, shift_tick_ns, body_tick_ns;
+    SpawnStats sp;
+    uint16_t len;
+    int m;
+    unsigned long errors = 0;
+    unsigned int i;
+
+    if (argc == 3 && !strcmp(argv[1], "-t")) {
+        run_us = atof(argv[2]) * 1e3;
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [-t ms]\n", argv[0]);
+        return 2;
+    }
+
+    build_path();
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) errors += check(lengths[i]);
+    errors += check(GRID_CELLS);            // 整個盤面：新的頭就是剛移走的尾巴
+    for (len = 1; len < GRID_CELLS; len += 89) errors += check_spawn(len);
+    errors += check_spawn(GRID_CELLS - 1);
+    printf("check: %s (%d ticks per length, free cell index at 25 lengths)\n",
+           errors ? "FAIL" : "ok", CHECK_TICKS);
+
+    printf("\n%-8s %10s %10s %12s %12s %16s %10s\n", "length", "shift ns", "body ns",
+           "shift+scan", "body+bitmap", "shift bytes/tick", "compares");
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        shift_ns = bench(lengths[i], shift_move, run_us);
+        body_ns = bench(lengths[i], body_move, run_us);
+        shift_tick_ns = bench(lengths[i], shift_tick, run_us);
+        body_tick_ns = bench(lengths[i], body_tick, run_us);
+        printf("%-8u %10.1f %10.1f %12.1f %12.1f %16u %10u\n", lengths[i], shift_ns, body_ns,
+               shift_tick_ns, body_tick_ns, 2u * lengths[i], (unsigned)lengths[i]);
+    }
+
+    printf("\n%-10s %-13s %10s %10s %10s %10s\n", "occupancy", "spawn", "avg tries", "max tries",
+           "avg ns", "max ns");
+    for (i = 0; i < sizeof(occupancy) / sizeof(occupancy[0]); i++) {
+        len = (uint16_t)(GRID_CELLS * occupancy[i] / 100);
+        for (m = 0; m < 3; m++) {
+            sp = bench_spawn(len, m);
+            printf("%3d%% %5u  %-13s %10.2f %10lu %10.1f %10.1f\n", occupancy[i], len, spawn_names[m],
+                   sp.avg_tries, sp.max_tries, sp.avg_ns, sp.max_ns);
+        }
+    }
+    return errors ? 1 : 0;
+}